@@ -0,0 +1,80 @@
+// Copyright (c) 2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <json.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+/*!
+ * Command line options shared by the benchmark executables:
+ * --quick limits the sizes and run time, --out writes JSON to a file.
+ */
+struct BenchOptions
+{
+    BenchOptions(void):
+        quick(false)
+    {
+        return;
+    }
+    bool quick;
+    std::string outPath;
+};
+
+inline BenchOptions parseBenchOptions(int argc, char **argv)
+{
+    BenchOptions opts;
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string arg(argv[i]);
+        if (arg == "--quick") opts.quick = true;
+        else if (arg == "--out" and i+1 < argc) opts.outPath = argv[++i];
+        else std::cerr << "Usage: " << argv[0] << " [--quick] [--out results.json]" << std::endl;
+    }
+    return opts;
+}
+
+//! seconds per measurement, the iteration count doubles until it is reached
+inline double benchMinSeconds(const BenchOptions &opts)
+{
+    return opts.quick? 0.05 : 0.25;
+}
+
+/*!
+ * Measure the time per operation of fcn(iterations) in nanoseconds.
+ * The iteration count used for the final measurement is stored in iterations.
+ */
+template <typename Fcn>
+double measureNsPerOp(Fcn &&fcn, size_t &iterations, const double minSeconds)
+{
+    fcn(size_t(1)); //warm up caches and lazy resolution
+    for (iterations = 1;; iterations *= 2)
+    {
+        const auto t0 = std::chrono::high_resolution_clock::now();
+        fcn(iterations);
+        const std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - t0;
+        if (elapsed.count() >= minSeconds or iterations >= (size_t(1) << 30))
+        {
+            return (elapsed.count()*1e9)/iterations;
+        }
+    }
+}
+
+//! write the results document to the output file or stdout
+inline int writeBenchResults(const nlohmann::json &doc, const BenchOptions &opts)
+{
+    if (opts.outPath.empty())
+    {
+        std::cout << doc.dump(4) << std::endl;
+        return EXIT_SUCCESS;
+    }
+    std::ofstream out(opts.outPath.c_str());
+    out << doc.dump(4) << std::endl;
+    if (out) return EXIT_SUCCESS;
+    std::cerr << "Failed to write " << opts.outPath << std::endl;
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,262 @@
+// Copyright (c) 2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "BenchUtils.hpp"
+#include <Pothos/Init.hpp>
+#include <Pothos/Proxy.hpp>
+#include <Pothos/Framework.hpp>
+#include <complex>
+#include <vector>
+
+/***********************************************************************
+ * Microbenchmarks for the python proxy environment:
+ * handle calls, accessors, converters, and python to managed calls.
+ * Results are written as JSON so that runs can be compared across commits.
+ **********************************************************************/
+class MicroBench
+{
+public:
+    MicroBench(const BenchOptions &opts):
+        _minSeconds(benchMinSeconds(opts)),
+        _results(nlohmann::json::array())
+    {
+        return;
+    }
+
+    template <typename Fcn>
+    void run(const std::string &group, const std::string &name, const size_t size, Fcn &&fcn)
+    {
+        size_t iterations(0);
+        const auto ns = measureNsPerOp(fcn, iterations, _minSeconds);
+        std::cerr << group << " " << name << " [" << size << "]: " << ns << " ns" << std::endl;
+        nlohmann::json result;
+        result["Group"] = group;
+        result["Name"] = name;
+        result["Size"] = size;
+        result["Iterations"] = iterations;
+        result["Nanoseconds"] = ns;
+        _results.push_back(result);
+    }
+
+    const nlohmann::json &results(void) const
+    {
+        return _results;
+    }
+
+private:
+    const double _minSeconds;
+    nlohmann::json _results;
+};
+
+static Pothos::Proxy getBuiltins(Pothos::ProxyEnvironment::Sptr env)
+{
+    try
+    {
+        return env->findProxy("builtins");
+    }
+    catch (const Pothos::Exception &)
+    {
+        return env->findProxy("__builtin__");
+    }
+}
+
+/***********************************************************************
+ * PythonProxyHandle::call with 0 to 4 args and get:/set: accessors
+ **********************************************************************/
+static void benchProxyCalls(MicroBench &bench, Pothos::ProxyEnvironment::Sptr env)
+{
+    auto builtins = getBuiltins(env);
+    auto fcn = builtins.call("eval", std::string("lambda *args: None"));
+    auto obj = builtins.call("eval", std::string(
+        "type('BenchObject', (object,), {'value': 0, 'method': lambda self, *args: None})()"));
+
+    Pothos::ProxyVector args;
+    for (int i = 0; i < 4; i++) args.push_back(env->makeProxy(i));
+
+    auto fcnHandle = fcn.getHandle();
+    auto objHandle = obj.getHandle();
+    for (size_t numArgs = 0; numArgs <= args.size(); numArgs++)
+    {
+        bench.run("ProxyHandle", "call()", numArgs, [&](const size_t n)
+        {
+            for (size_t i = 0; i < n; i++) fcnHandle->call("()", args.data(), numArgs);
+        });
+        bench.run("ProxyHandle", "call(method)", numArgs, [&](const size_t n)
+        {
+            for (size_t i = 0; i < n; i++) objHandle->call("method", args.data(), numArgs);
+        });
+    }
+
+    bench.run("ProxyHandle", "get:value", 0, [&](const size_t n)
+    {
+        for (size_t i = 0; i < n; i++) objHandle->call("get:value", nullptr, 0);
+    });
+    bench.run("ProxyHandle", "set:value", 1, [&](const size_t n)
+    {
+        for (size_t i = 0; i < n; i++) objHandle->call("set:value", args.data(), 1);
+    });
+}
+
+/***********************************************************************
+ * Converters in PythonConvert.cpp and FrameworkTypes.cpp
+ **********************************************************************/
+static void benchFromPython(MicroBench &bench, Pothos::ProxyEnvironment::Sptr env,
+    const std::string &name, const size_t size, const Pothos::Proxy &proxy)
+{
+    bench.run("FromPython", name, size, [&](const size_t n)
+    {
+        for (size_t i = 0; i < n; i++) env->convertProxyToObject(proxy);
+    });
+}
+
+static void benchConverter(MicroBench &bench, Pothos::ProxyEnvironment::Sptr env,
+    const std::string &name, const size_t size, const Pothos::Object &obj)
+{
+    bench.run("ToPython", name, size, [&](const size_t n)
+    {
+        for (size_t i = 0; i < n; i++) env->convertObjectToProxy(obj);
+    });
+    benchFromPython(bench, env, name, size, env->convertObjectToProxy(obj));
+}
+
+template <typename T>
+static void benchVectorConverter(MicroBench &bench, Pothos::ProxyEnvironment::Sptr env,
+    const std::string &name, const size_t size)
+{
+    std::vector<T> vec(size);
+    for (size_t i = 0; i < size; i++) vec[i] = T(i % 100);
+    benchConverter(bench, env, "std::vector<" + name + ">", size, Pothos::Object(vec));
+}
+
+static void benchConverters(MicroBench &bench, Pothos::ProxyEnvironment::Sptr env, const std::vector<size_t> &sizes)
+{
+    auto builtins = getBuiltins(env);
+
+    //scalar converters
+    benchConverter(bench, env, "null", 1, Pothos::Object());
+    benchConverter(bench, env, "bool", 1, Pothos::Object(true));
+    benchConverter(bench, env, "char", 1, Pothos::Object(char(1)));
+    benchConverter(bench, env, "signed char", 1, Pothos::Object((signed char)(1)));
+    benchConverter(bench, env, "unsigned char", 1, Pothos::Object((unsigned char)(1)));
+    benchConverter(bench, env, "short", 1, Pothos::Object(short(1)));
+    benchConverter(bench, env, "unsigned short", 1, Pothos::Object((unsigned short)(1)));
+    benchConverter(bench, env, "int", 1, Pothos::Object(int(1)));
+    benchConverter(bench, env, "unsigned int", 1, Pothos::Object((unsigned int)(1)));
+    benchConverter(bench, env, "long", 1, Pothos::Object(long(1)));
+    benchConverter(bench, env, "unsigned long", 1, Pothos::Object((unsigned long)(1)));
+    benchConverter(bench, env, "long long", 1, Pothos::Object((long long)(1)));
+    benchConverter(bench, env, "unsigned long long", 1, Pothos::Object((unsigned long long)(1)));
+    benchConverter(bench, env, "float", 1, Pothos::Object(1.0f));
+    benchConverter(bench, env, "double", 1, Pothos::Object(1.0));
+    benchConverter(bench, env, "std::complex<float>", 1, Pothos::Object(std::complex<float>(1.0f, 2.0f)));
+    benchConverter(bench, env, "std::complex<double>", 1, Pothos::Object(std::complex<double>(1.0, 2.0)));
+
+    //sized converters
+    for (const auto size : sizes)
+    {
+        benchConverter(bench, env, "std::string", size, Pothos::Object(std::string(size, 'x')));
+        benchConverter(bench, env, "std::vector<std::string>", size, Pothos::Object(std::vector<std::string>(size, "x")));
+        benchVectorConverter<char>(bench, env, "char", size);
+        benchVectorConverter<signed char>(bench, env, "signed char", size);
+        benchVectorConverter<unsigned char>(bench, env, "unsigned char", size);
+        benchVectorConverter<short>(bench, env, "short", size);
+        benchVectorConverter<unsigned short>(bench, env, "unsigned short", size);
+        benchVectorConverter<int>(bench, env, "int", size);
+        benchVectorConverter<unsigned int>(bench, env, "unsigned int", size);
+        benchVectorConverter<long>(bench, env, "long", size);
+        benchVectorConverter<unsigned long>(bench, env, "unsigned long", size);
+        benchVectorConverter<long long>(bench, env, "long long", size);
+        benchVectorConverter<unsigned long long>(bench, env, "unsigned long long", size);
+        benchVectorConverter<float>(bench, env, "float", size);
+        benchVectorConverter<double>(bench, env, "double", size);
+        benchVectorConverter<std::complex<float>>(bench, env, "std::complex<float>", size);
+        benchVectorConverter<std::complex<double>>(bench, env, "std::complex<double>", size);
+
+        //proxy containers to list, set, and dict
+        Pothos::ProxyVector proxyVec(size);
+        Pothos::ProxySet proxySet;
+        Pothos::ProxyMap proxyMap;
+        for (size_t i = 0; i < size; i++)
+        {
+            proxyVec[i] = env->makeProxy((long long)(i));
+            proxySet.insert(proxyVec[i]);
+            proxyMap[proxyVec[i]] = proxyVec[i];
+        }
+        benchConverter(bench, env, "Pothos::ProxyVector", size, Pothos::Object(proxyVec));
+        benchConverter(bench, env, "Pothos::ProxySet", size, Pothos::Object(proxySet));
+        benchConverter(bench, env, "Pothos::ProxyMap", size, Pothos::Object(proxyMap));
+
+        //python only types: tuple to vector and bytearray to string
+        benchFromPython(bench, env, "tuple", size, builtins.call("tuple", builtins.call("range", size)));
+        benchFromPython(bench, env, "bytearray", size, builtins.call("bytearray", size));
+
+        //buffer chunk to numpy array and back
+        for (const auto &dtype : {"int16", "float32", "complex_float64"})
+        {
+            const Pothos::BufferChunk buffer(Pothos::DType(dtype), size);
+            benchConverter(bench, env, std::string("Pothos::BufferChunk ") + dtype, size, Pothos::Object(buffer));
+        }
+    }
+}
+
+/***********************************************************************
+ * Python to managed calls through Proxy_call and ProxyCall_call
+ **********************************************************************/
+static void benchManagedCalls(MicroBench &bench, Pothos::ProxyEnvironment::Sptr env)
+{
+    const std::string setup =
+        "import Pothos\n"
+        "env = Pothos.ProxyEnvironment('managed')\n"
+        "DType = env.findProxy('Pothos/DType')\n"
+        "dtype = DType('float32')\n"
+        "size = dtype.size\n"
+        "fromDType = DType.fromDType\n";
+
+    const std::vector<std::pair<std::string, std::string>> statements = {
+        {"Proxy_call", "dtype.call('size')"},
+        {"ProxyCall_call", "size()"},
+        {"getattr + ProxyCall_call", "dtype.size()"},
+        {"ProxyCall_call 2 args", "fromDType(dtype, 2)"},
+        {"Proxy_callFunc", "DType('float32')"},
+    };
+
+    auto timeit = env->findProxy("timeit");
+    for (const auto &statement : statements)
+    {
+        auto timer = timeit.call("Timer", statement.second, setup);
+        bench.run("PythonToManaged", statement.first, 0, [&](const size_t n)
+        {
+            timer.call("timeit", n);
+        });
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const auto opts = parseBenchOptions(argc, argv);
+    Pothos::ScopedInit init;
+
+    try
+    {
+        auto env = Pothos::ProxyEnvironment::make("python");
+        const auto sizes = opts.quick?
+            std::vector<size_t>{1, 1024, 65536}:
+            std::vector<size_t>{1, 16, 1024, 65536, 1 << 20};
+
+        MicroBench bench(opts);
+        benchProxyCalls(bench, env);
+        benchConverters(bench, env, sizes);
+        benchManagedCalls(bench, env);
+
+        nlohmann::json doc;
+        doc["Python Version"] = env->findProxy("sys").get<std::string>("version");
+        doc["Quick"] = opts.quick;
+        doc["Micro Benchmarks"] = bench.results();
+        return writeBenchResults(doc, opts);
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        std::cerr << ex.displayText() << std::endl;
+        return EXIT_FAILURE;
+    }
+}
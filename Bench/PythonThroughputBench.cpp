@@ -0,0 +1,210 @@
+// Copyright (c) 2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "BenchUtils.hpp"
+#include <Pothos/Init.hpp>
+#include <Pothos/Proxy.hpp>
+#include <Pothos/Framework.hpp>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+/***********************************************************************
+ * End to end throughput of feeder -> N forwarders -> collector
+ * with python forwarder blocks and with native forwarders as a baseline.
+ **********************************************************************/
+class NativeForwarder : public Pothos::Block
+{
+public:
+    NativeForwarder(const Pothos::DType &dtype)
+    {
+        this->setupInput(0, dtype);
+        this->setupOutput(0, dtype);
+    }
+
+    void work(void)
+    {
+        const size_t n = this->workInfo().minElements;
+        if (n == 0) return;
+        auto in0 = this->input(0);
+        auto out0 = this->output(0);
+        std::memcpy(this->workInfo().outputPointers[0], this->workInfo().inputPointers[0], n*in0->dtype().size());
+        in0->consume(n);
+        out0->produce(n);
+    }
+};
+
+//! like /python/forwarder without its prints, which would be timed with the work
+static const char *silentForwarderSource =
+    "import Pothos\n"
+    "class BenchForwarder(Pothos.Block):\n"
+    "    def __init__(self, dtype):\n"
+    "        Pothos.Block.__init__(self)\n"
+    "        self.setupInput('0', dtype)\n"
+    "        self.setupOutput('0', dtype)\n"
+    "    def work(self):\n"
+    "        in0 = self.input('0')\n"
+    "        if not in0.elements(): return\n"
+    "        out0 = self.output('0')\n"
+    "        inBuff = in0.buffer()\n"
+    "        outBuff = out0.buffer()\n"
+    "        n = min(len(inBuff), len(outBuff))\n"
+    "        outBuff[:n] = inBuff[:n]\n"
+    "        in0.consume(n)\n"
+    "        out0.produce(n)\n";
+
+static Pothos::Proxy makeSilentForwarderClass(void)
+{
+    auto env = Pothos::ProxyEnvironment::make("python");
+    Pothos::Proxy builtins;
+    try {builtins = env->findProxy("builtins");}
+    catch (const Pothos::Exception &) {builtins = env->findProxy("__builtin__");}
+
+    //eval of compiled exec code works the same on python 2 and 3
+    auto code = builtins.call("compile", std::string(silentForwarderSource), std::string("<bench>"), std::string("exec"));
+    auto ns = builtins.call("dict");
+    builtins.call("eval", code, ns);
+    return ns.call("__getitem__", std::string("BenchForwarder"));
+}
+
+//! the idle time that marks a chain as done, it is included in the timed run
+static const double idleSeconds = 0.01;
+
+struct ChainResult
+{
+    double seconds;
+    unsigned long long workCalls;
+    double workNanoseconds;
+};
+
+//! sum the work stats of the chain blocks from the topology stats
+static void sumWorkStats(const std::string &statsStr, const std::vector<std::string> &uids, ChainResult &result)
+{
+    const auto stats = nlohmann::json::parse(statsStr);
+    result.workCalls = 0;
+    result.workNanoseconds = 0.0;
+    for (const auto &uid : uids)
+    {
+        if (not stats.count(uid)) throw Pothos::Exception("sumWorkStats()", "no stats for block " + uid);
+        const auto &blockStats = stats[uid];
+        result.workCalls += blockStats.value("numWorkCalls", 0ull);
+        result.workNanoseconds += blockStats.value("totalTimeWork", 0.0); //nanoseconds
+    }
+}
+
+static ChainResult runChain(const Pothos::Proxy &pythonForwarder, const bool python, const size_t chainLength,
+    const Pothos::DType &dtype, const size_t bufferSize, const size_t numBuffers)
+{
+    auto feeder = Pothos::BlockRegistry::make("/blocks/feeder_source", dtype);
+    auto collector = Pothos::BlockRegistry::make("/blocks/collector_sink", dtype);
+
+    std::vector<Pothos::Proxy> pythonBlocks;
+    std::vector<std::shared_ptr<Pothos::Block>> nativeBlocks;
+    std::vector<std::string> uids;
+    for (size_t i = 0; i < chainLength; i++)
+    {
+        if (python)
+        {
+            pythonBlocks.push_back(pythonForwarder(dtype));
+            uids.push_back(pythonBlocks.back().call<std::string>("uid"));
+        }
+        else
+        {
+            nativeBlocks.emplace_back(new NativeForwarder(dtype));
+            uids.push_back(nativeBlocks.back()->uid());
+        }
+    }
+
+    ChainResult result;
+    {
+        Pothos::Topology topology;
+        for (size_t i = 0; i <= chainLength; i++)
+        {
+            //connect feeder -> forwarders... -> collector
+            Pothos::Object src = (i == 0)? Pothos::Object(feeder) :
+                (python? Pothos::Object(pythonBlocks[i-1]) : Pothos::Object(nativeBlocks[i-1]));
+            Pothos::Object dst = (i == chainLength)? Pothos::Object(collector) :
+                (python? Pothos::Object(pythonBlocks[i]) : Pothos::Object(nativeBlocks[i]));
+            topology.connect(src, 0, dst, 0);
+        }
+
+        //time from the first data to the chain going idle, commit is not timed,
+        //the same buffer is fed repeatedly, the forwarders only read from it
+        topology.commit();
+        const Pothos::BufferChunk buffer(dtype, bufferSize);
+        std::memset(buffer.as<void *>(), 0, buffer.length);
+        const auto t0 = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < numBuffers; i++) feeder.call("feedBuffer", buffer);
+        if (not topology.waitInactive(idleSeconds, 600.0)) throw Pothos::Exception("runChain()", "timeout");
+        const std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - t0;
+        result.seconds = elapsed.count();
+        sumWorkStats(topology.queryJSONStats(), uids, result);
+    }
+
+    const auto collected = collector.call<Pothos::BufferChunk>("getBuffer");
+    if (collected.elements() != bufferSize*numBuffers) throw Pothos::Exception("runChain()",
+        "collected " + std::to_string(collected.elements()) + " of " + std::to_string(bufferSize*numBuffers) + " elements");
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    const auto opts = parseBenchOptions(argc, argv);
+    Pothos::ScopedInit init;
+
+    try
+    {
+        const size_t totalElements = opts.quick? (1 << 18) : (1 << 22);
+        const std::vector<size_t> chainLengths = {1, 4, 16};
+        const std::vector<std::string> dtypes = {"int8", "float32", "complex_float32"};
+        const auto bufferSizes = opts.quick?
+            std::vector<size_t>{1024, 65536}:
+            std::vector<size_t>{256, 4096, 65536};
+
+        const auto pythonForwarder = makeSilentForwarderClass();
+        auto results = nlohmann::json::array();
+        for (const auto python : {false, true})
+        for (const auto chainLength : chainLengths)
+        for (const auto &dtype : dtypes)
+        for (const auto bufferSize : bufferSizes)
+        {
+            const size_t numBuffers = std::max<size_t>(16, totalElements/bufferSize);
+            const auto chain = runChain(pythonForwarder, python, chainLength, Pothos::DType(dtype), bufferSize, numBuffers);
+            const double elements = double(bufferSize*numBuffers);
+
+            //rates use the raw time, which includes the idle detection;
+            //when that is a large part of the run, the rates understate throughput
+            const bool overheadDominated = idleSeconds > 0.1*chain.seconds;
+
+            nlohmann::json result;
+            result["Blocks"] = python? "python" : "native";
+            result["Chain Length"] = chainLength;
+            result["DType"] = dtype;
+            result["Buffer Size"] = bufferSize;
+            result["Elements"] = bufferSize*numBuffers;
+            result["Seconds"] = chain.seconds;
+            result["Idle Detect Seconds"] = idleSeconds;
+            result["Overhead Dominated"] = overheadDominated;
+            result["Elements Per Second"] = elements/chain.seconds;
+            result["Work Calls"] = chain.workCalls;
+            result["Work Calls Per Second"] = chain.workCalls/chain.seconds;
+            result["Microseconds Per Work Call"] = (chain.workCalls == 0)? 0.0 : chain.workNanoseconds/chain.workCalls/1e3;
+            results.push_back(result);
+
+            std::cerr << result["Blocks"].get<std::string>() << " x" << chainLength << " " << dtype
+                << " [" << bufferSize << "]: " << result["Elements Per Second"].get<double>()/1e6 << " Melem/s"
+                << (overheadDominated? " (overhead dominated)" : "") << std::endl;
+        }
+
+        nlohmann::json doc;
+        doc["Python Version"] = Pothos::ProxyEnvironment::make("python")->findProxy("sys").get<std::string>("version");
+        doc["Quick"] = opts.quick;
+        doc["Throughput Benchmarks"] = results;
+        return writeBenchResults(doc, opts);
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        std::cerr << ex.displayText() << std::endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -1,37 +1,135 @@
 // Copyright (c) 2016-2017 Josh Blum
 // SPDX-License-Identifier: BSL-1.0
 
+#include "PythonProxy.hpp"
 #include <Pothos/Plugin.hpp>
 #include <Pothos/Proxy.hpp>
 #include <Pothos/Framework/BufferChunk.hpp>
 #include <complex>
 #include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
 
 /***********************************************************************
  * buffer chunk to/from numpy
  **********************************************************************/
+static std::mutex bufferChunkToPyObjectMutex;
+static BufferChunkToPyObjectFcn bufferChunkToPyObjectFcn;
+
+//! the helper is cached while registered, the PothosModule removes it on unload
+static void handleBufferChunkPluginEvent(const Pothos::Plugin &plugin, const std::string &event)
+{
+    if (not (plugin.getPath() == Pothos::PluginPath("/proxy_helpers/python/buffer_chunk/to_pyobject"))) return;
+    std::lock_guard<std::mutex> lock(bufferChunkToPyObjectMutex);
+    if (event == "add") bufferChunkToPyObjectFcn = plugin.getObject().extract<BufferChunkToPyObjectFcn>();
+    if (event == "remove") bufferChunkToPyObjectFcn = BufferChunkToPyObjectFcn();
+}
+
 static Pothos::Proxy convertBufferChunkToNumpyArray(Pothos::ProxyEnvironment::Sptr env, const Pothos::BufferChunk &buffer)
 {
-    auto module = env->findProxy("Pothos.Buffer");
-    auto dtype = module.get("dtype_to_numpy")(buffer.dtype);
-    return module.get("pointer_to_ndarray")(buffer.address, buffer.elements(), dtype);
+    BufferChunkToPyObjectFcn bufferChunkToPyObject;
+    {
+        std::lock_guard<std::mutex> lock(bufferChunkToPyObjectMutex);
+        bufferChunkToPyObject = bufferChunkToPyObjectFcn;
+    }
+
+    //the native buffer type lives in the PothosModule, importing it registers the helper
+    if (not bufferChunkToPyObject)
+    {
+        env->findProxy("Pothos.PothosModule");
+        bufferChunkToPyObject = Pothos::PluginRegistry::get("/proxy_helpers/python/buffer_chunk/to_pyobject").getObject().extract<BufferChunkToPyObjectFcn>();
+    }
+
+    return std::dynamic_pointer_cast<PythonProxyEnvironment>(env)->makeHandle(bufferChunkToPyObject(buffer), REF_NEW);
+}
+
+static Pothos::DType numpyNameToDType(const std::string &name, const size_t dimension)
+{
+    //filled once per type so steady-state lookups skip dtype parsing
+    static std::mutex mutex;
+    static std::map<std::pair<std::string, size_t>, Pothos::DType> cache;
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto key = std::make_pair(name, dimension);
+    auto it = cache.find(key);
+    if (it == cache.end()) it = cache.emplace(key, Pothos::DType(name, dimension)).first;
+    return it->second;
+}
+
+static void releasePyBuffer(const std::shared_ptr<PythonProxyEnvironment> &env, Py_buffer *view)
+{
+    //the last chunk reference may be dropped from any thread
+    if (env->interpreterAlive())
+    {
+        PyInterpLock lock(env.get());
+        PyBuffer_Release(view);
+    }
+    delete view;
+}
+
+static std::string bufferFormatToNumpyName(const char *format, const Py_ssize_t itemsize)
+{
+    //only native byte order can be described by a numpy type name
+    if (format == nullptr) format = "B";
+    const uint16_t one(1);
+    const bool littleEndian = *reinterpret_cast<const uint8_t *>(&one) == 1;
+    if (*format == '@' or *format == '=') format++;
+    else if (*format == '<' and littleEndian) format++;
+    else if ((*format == '>' or *format == '!') and not littleEndian) format++;
+
+    const auto bits = std::to_string(8*itemsize);
+    if (std::strlen(format) == 1 and std::strchr("bhilq", *format) != nullptr) return "int"+bits;
+    if (std::strlen(format) == 1 and std::strchr("BHILQ", *format) != nullptr) return "uint"+bits;
+    if (std::strlen(format) == 1 and std::strchr("efd", *format) != nullptr) return "float"+bits;
+    if (std::strcmp(format, "Zf") == 0 or std::strcmp(format, "Zd") == 0) return "complex"+bits;
+    return "";
+}
+
+static bool convertBufferProtocolToBufferChunk(const PythonProxyHandle &handle, Pothos::BufferChunk &chunk)
+{
+    std::unique_ptr<Py_buffer> view(new Py_buffer());
+    if (PyObject_GetBuffer(handle.obj, view.get(), PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0)
+    {
+        PyErr_Clear();
+        return false;
+    }
+
+    //the shared buffer container releases the view when the last chunk is gone
+    const auto env = handle.env;
+    std::shared_ptr<Py_buffer> container(view.release(), [env](Py_buffer *v){releasePyBuffer(env, v);});
+    const auto dtypeName = bufferFormatToNumpyName(container->format, container->itemsize);
+    if (dtypeName.empty()) return false;
+    const size_t dimension = (container->ndim > 1)? size_t(container->shape[1]) : 1;
+
+    auto sharedBuff = Pothos::SharedBuffer(size_t(container->buf), size_t(container->len), container);
+    chunk = Pothos::BufferChunk(sharedBuff);
+    chunk.dtype = numpyNameToDType(dtypeName, dimension);
+    return true;
 }
 
 static Pothos::BufferChunk convertNumpyArrayToBufferChunk(const Pothos::Proxy &npArray)
 {
+    //fast path: acquire the memory and layout with the buffer protocol
+    Pothos::BufferChunk chunk;
+    const auto handle = std::dynamic_pointer_cast<PythonProxyHandle>(npArray.getHandle());
+    if (handle and convertBufferProtocolToBufferChunk(*handle, chunk)) return chunk;
+
     //extract shape and data type information
     const auto shape = npArray.get<Pothos::ProxyVector>("shape");
     const size_t numBytes = npArray.get<size_t>("nbytes");
     const size_t dimension = (shape.size() > 1)? shape.at(1).convert<size_t>() : 1;
     const auto dtypeName = npArray.get("dtype").get<std::string>("name");
-    const Pothos::DType dtype(dtypeName, dimension);
+    const auto dtype = numpyNameToDType(dtypeName, dimension);
     const size_t address = npArray.get("__array_interface__").call("get", "data").call("__getitem__", 0);
 
     //create a shared buffer that holds the numpy array
     auto sharedBuff = Pothos::SharedBuffer(address, numBytes, npArray.getHandle());
 
     //now create a buffer chunk of that shared buffer with matching dtype
-    auto chunk = Pothos::BufferChunk(sharedBuff);
+    chunk = Pothos::BufferChunk(sharedBuff);
     chunk.dtype = dtype;
     return chunk;
 }
@@ -56,6 +154,8 @@ static std::complex<T> convertNumpyComplexToNative(const Pothos::Proxy &num)
 
 pothos_static_block(pothosRegisterNumpyBufferConversions)
 {
+    Pothos::PluginRegistry::addCall("/proxy_helpers/python/buffer_chunk",
+        &handleBufferChunkPluginEvent);
     Pothos::PluginRegistry::addCall("/proxy/converters/python/buffer_chunk_to_numpy_array",
         &convertBufferChunkToNumpyArray);
     Pothos::PluginRegistry::add("/proxy/converters/python/numpy_array_to_buffer_chunk",
@@ -4,18 +4,24 @@
 from . PothosModule import *
 from . InputPort import InputPort
 from . OutputPort import OutputPort
-from . Label import Label, LabelIteratorRange
 from . BlockRegistry import BlockRegistry
+import logging
 import weakref
 
 class Block(object):
     def __init__(self):
         self._block = BlockRegistry("/blocks/python_block")
         self._block._setPyBlock(weakref.proxy(self))
+        self._inputs = dict()
+        self._outputs = dict()
 
     def __getattr__(self, name):
         return lambda *args: self._block.call(name, *args)
 
+    def getLogger(self):
+        """A python logger for this block class, forwarded into the Poco "Pothos" logger."""
+        return logging.getLogger("Pothos." + type(self).__name__)
+
     def getInternalBlock(self):
         """
         Get access to the underlying Pothos::Block handle.
@@ -32,7 +38,12 @@ class Block(object):
         return dict([(key, InputPort(ports.at(key))) for key in ports.keys()])
 
     def input(self, name):
-        return InputPort(self._block.input(name))
+        #port wrappers are cached per name for work()
+        try: return self._inputs[name]
+        except KeyError: pass
+        port = InputPort(self._block.input(name))
+        self._inputs[name] = port
+        return port
 
     def outputs(self):
         ports = self._block.outputs()
@@ -43,7 +54,12 @@ class Block(object):
         return dict([(key, OutputPort(ports.at(key))) for key in ports.keys()])
 
     def output(self, name):
-        return OutputPort(self._block.output(name))
+        #port wrappers are cached per name for work()
+        try: return self._outputs[name]
+        except KeyError: pass
+        port = OutputPort(self._block.output(name))
+        self._outputs[name] = port
+        return port
 
     def activate(self): pass
 
@@ -1,23 +1,12 @@
 # Copyright (c) 2014-2016 Josh Blum
 # SPDX-License-Identifier: BSL-1.0
 
+from . PothosModule import dtypeToNumpy
 import numpy
 
 def dtype_to_numpy(dtype):
-    name = dtype.name()
-    if dtype.dimension() == 1: shape = []
-    else: shape = [dtype.dimension()]
-
-    #support numpy float-complex types
-    if name == 'complex_float32': name = "complex64"
-    elif name == 'complex_float64': name = "complex128"
-
-    #no integer complex types, make tuple
-    elif name.startswith('complex_'):
-        name = name.split('_', 1)[1]
-        shape = [2] + list(shape)
-
-    return numpy.dtype((name, tuple(shape)))
+    #resolved once per type and cached by the module
+    return dtypeToNumpy(dtype)
 
 def pointer_to_ndarray(addr, nitems, dtype=numpy.dtype(numpy.uint8), readonly=False):
     class array_like:
@@ -0,0 +1,229 @@
+// Copyright (c) 2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "PothosModule.hpp"
+#include <new>
+
+static void Label_dealloc(LabelObject *self)
+{
+    self->label.~Label();
+    freePothosObject((PyObject *)self);
+}
+
+static PyObject *Label_new(PyTypeObject *type, PyObject *, PyObject *)
+{
+    auto self = reinterpret_cast<LabelObject *>(type->tp_alloc(type, 0));
+    if (self == nullptr) return nullptr;
+    new (&self->label) Pothos::Label();
+    return (PyObject *)self;
+}
+
+static PyObject *Label_repr(LabelObject *self)
+{
+    const auto repr = "Label(" + self->label.id +
+        ", index=" + std::to_string(self->label.index) +
+        ", width=" + std::to_string(self->label.width) + ")";
+    return StdStringToPyObject(repr);
+}
+
+/***********************************************************************
+ * label attributes, data is converted on access
+ **********************************************************************/
+static bool checkSetValue(PyObject *value)
+{
+    if (value != nullptr) return true;
+    PyErr_SetString(PyExc_TypeError, "cannot delete label attributes");
+    return false;
+}
+
+static bool getNonNegative(PyObject *value, unsigned long long &num)
+{
+    const auto n = PyNumber_AsSsize_t(value, PyExc_OverflowError);
+    if (n == -1 and PyErr_Occurred()) return false;
+    if (n < 0)
+    {
+        PyErr_SetString(PyExc_ValueError, "label index and width must be non-negative");
+        return false;
+    }
+    num = (unsigned long long)n;
+    return true;
+}
+
+static PyObject *Label_getId(LabelObject *self, void *)
+{
+    return StdStringToPyObject(self->label.id);
+}
+
+static int Label_setId(LabelObject *self, PyObject *value, void *)
+{
+    if (not checkSetValue(value)) return -1;
+    PyObjectRef str(PyObject_Str(value), REF_NEW);
+    if (str.obj == nullptr) return -1;
+    self->label.id = PyObjToStdString(str.obj);
+    return 0;
+}
+
+static PyObject *Label_getData(LabelObject *self, void *)
+{
+    try
+    {
+        return translateObjectToPyObject(self->label.data);
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        PyErr_SetString(PyExc_RuntimeError, ex.displayText().c_str());
+        return nullptr;
+    }
+}
+
+static int Label_setData(LabelObject *self, PyObject *value, void *)
+{
+    if (not checkSetValue(value)) return -1;
+    try
+    {
+        self->label.data = PyObjectToProxy(value).toObject();
+        return 0;
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        PyErr_SetString(PyExc_RuntimeError, ex.displayText().c_str());
+        return -1;
+    }
+}
+
+static PyObject *Label_getIndex(LabelObject *self, void *)
+{
+    return PyLong_FromUnsignedLongLong(self->label.index);
+}
+
+static int Label_setIndex(LabelObject *self, PyObject *value, void *)
+{
+    unsigned long long index(0);
+    if (not checkSetValue(value) or not getNonNegative(value, index)) return -1;
+    self->label.index = index;
+    return 0;
+}
+
+static PyObject *Label_getWidth(LabelObject *self, void *)
+{
+    return PyLong_FromSize_t(self->label.width);
+}
+
+static int Label_setWidth(LabelObject *self, PyObject *value, void *)
+{
+    unsigned long long width(0);
+    if (not checkSetValue(value) or not getNonNegative(value, width)) return -1;
+    self->label.width = size_t(width);
+    return 0;
+}
+
+//! NativeLabel(id="", data=None, index=0, width=1) like Pothos.Label(...)
+static int Label_init(LabelObject *self, PyObject *args, PyObject *kwds)
+{
+    static const char *kwlist[] = {"id", "data", "index", "width", nullptr};
+    PyObject *id = nullptr, *data = nullptr, *index = nullptr, *width = nullptr;
+    if (not PyArg_ParseTupleAndKeywords(args, kwds, "|OOOO", (char **)kwlist, &id, &data, &index, &width)) return -1;
+    if (id != nullptr and Label_setId(self, id, nullptr) < 0) return -1;
+    if (data != nullptr and Label_setData(self, data, nullptr) < 0) return -1;
+    if (index != nullptr and Label_setIndex(self, index, nullptr) < 0) return -1;
+    if (width != nullptr and Label_setWidth(self, width, nullptr) < 0) return -1;
+    return 0;
+}
+
+static PyGetSetDef Label_getset[] = {
+    {(char *)"id", (getter)Label_getId, (setter)Label_setId, (char *)"The label identifier string", nullptr},
+    {(char *)"data", (getter)Label_getData, (setter)Label_setData, (char *)"The label data", nullptr},
+    {(char *)"index", (getter)Label_getIndex, (setter)Label_setIndex, (char *)"The element index of the label", nullptr},
+    {(char *)"width", (getter)Label_getWidth, (setter)Label_setWidth, (char *)"The width of the label in elements", nullptr},
+    {nullptr}  /* Sentinel */
+};
+
+/***********************************************************************
+ * comparison with native labels and Pothos.Label proxies
+ **********************************************************************/
+static PyObject *Label_richcompare(PyObject *self, PyObject *other, int op)
+{
+    if ((op != Py_EQ and op != Py_NE) or not (isLabelObject(other) or isProxyObject(other)))
+    {
+        Py_INCREF(Py_NotImplemented);
+        return Py_NotImplemented;
+    }
+    try
+    {
+        const bool equal = pyObjectToLabel(self) == pyObjectToLabel(other);
+        return PyBool_FromLong((op == Py_EQ)? equal : not equal);
+    }
+    catch (const Pothos::Exception &)
+    {
+        Py_INCREF(Py_NotImplemented);
+        return Py_NotImplemented;
+    }
+}
+
+//! other attributes fall back to a managed copy of the label
+static PyObject *Label_getattr(LabelObject *self, PyObject *attr_name)
+{
+    PyObject *attr = PyObject_GenericGetAttr((PyObject *)self, attr_name);
+    if (attr != nullptr) return attr;
+    if (not PyErr_ExceptionMatches(PyExc_AttributeError)) return nullptr;
+    PyErr_Clear();
+    try
+    {
+        auto managed = Pothos::ProxyEnvironment::make("managed")->makeProxy(self->label);
+        PyObjectRef proxy(makeProxyObject(managed), REF_NEW);
+        if (proxy.obj == nullptr) return nullptr;
+        return PyObject_GetAttr(proxy.obj, attr_name);
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        PyErr_SetString(PyExc_RuntimeError, ex.displayText().c_str());
+        return nullptr;
+    }
+}
+
+/***********************************************************************
+ * label utilities for the c api
+ **********************************************************************/
+PyObject *makeLabelObject(const Pothos::Label &label)
+{
+    auto self = reinterpret_cast<LabelObject *>(allocPothosObject(getModuleState().labelType));
+    if (self == nullptr) return nullptr;
+    new (&self->label) Pothos::Label(label);
+    return (PyObject *)self;
+}
+
+bool isLabelObject(PyObject *obj)
+{
+    return PyObject_TypeCheck(obj, reinterpret_cast<PyTypeObject *>(getModuleState().labelType.obj));
+}
+
+Pothos::Label pyObjectToLabel(PyObject *obj)
+{
+    if (isLabelObject(obj)) return reinterpret_cast<LabelObject *>(obj)->label;
+    return PyObjectToProxy(obj).convert<Pothos::Label>();
+}
+
+static PyType_Slot LabelType_slots[] = {
+    {Py_tp_new, (void *)Label_new},
+    {Py_tp_init, (void *)Label_init},
+    {Py_tp_dealloc, (void *)Label_dealloc},
+    {Py_tp_richcompare, (void *)Label_richcompare},
+    {Py_tp_getattro, (void *)Label_getattr},
+    {Py_tp_repr, (void *)Label_repr},
+    {Py_tp_doc, (void *)"Pothos Label, constructed like Pothos.Label(id, data, index, width)"},
+    {Py_tp_getset, (void *)Label_getset},
+    {0, nullptr}
+};
+
+static PyType_Spec LabelType_spec = {
+    "Pothos.PothosModule.NativeLabel",
+    sizeof(LabelObject),
+    0,
+    Py_TPFLAGS_DEFAULT,
+    LabelType_slots
+};
+
+int registerLabelType(PothosModuleState &state)
+{
+    return makePothosType(&LabelType_spec, state.labelType);
+}
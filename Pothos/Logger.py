@@ -8,17 +8,54 @@ import logging
 class LogHandler(logging.Handler):
     def __init__(self, name):
         logging.Handler.__init__(self)
-        env = ProxyEnvironment("managed")
-        self._logger = env.findProxy("Pothos/Python/Logger")(name)
+        self._loggerName = name
+        self._logger = None
+
+    def _getLogger(self):
+        #records are queued and logged by a background thread
+        if self._logger is None:
+            self._logger = AsyncLogger(self._loggerName)
+        return self._logger
+
+    def getPocoLevel(self):
+        return getLogLevel(self._loggerName)
 
     def emit(self, record):
-        level = {
-            logging.FATAL:'FATAL',
-            logging.CRITICAL:'CRITICAL',
-            logging.ERROR:'ERROR',
-            logging.WARNING:'WARNING',
-            logging.INFO:'INFO',
-            logging.DEBUG:'DEBUG',
-            logging.NOTSET:'NOTSET',
-        }[record.levelno]
-        self._logger.log(record.name, record.getMessage(), level)
+        #skip formatting records that the Poco logger would drop
+        logger = self._getLogger()
+        if record.levelno < logger.level: return
+        logger.log(record.name, record.getMessage(), record.levelno)
+
+        #the drainer thread counts level changes, sync only when it moved
+        if getLogLevelGeneration(False) != _syncedGeneration[0]: syncLogLevels()
+
+    def flush(self):
+        if self._logger is not None: self._logger.flush()
+
+#python loggers whose level follows the Poco logger of their handler
+_boundLoggers = list()
+_syncedGeneration = [None]
+def bindLogger(logger, name=None):
+    """
+    Forward the python logger into the named Poco logger (default logger.name).
+    The python level follows the Poco level so that disabled calls are
+    rejected by the python logger before a record is created.
+    """
+    handler = LogHandler(logger.name if name is None else name)
+    logger.addHandler(handler)
+    logger.setLevel(handler.getPocoLevel())
+    _boundLoggers.append((logger, handler))
+    return handler
+
+def syncLogLevels():
+    """
+    Apply Poco level changes to the bound python loggers.
+    Python blocks sync on work() and activate() after the drainer sees a change,
+    and so do records of bound loggers; call this to apply a change sooner.
+    """
+    generation = getLogLevelGeneration()
+    if generation == _syncedGeneration[0]: return
+    _syncedGeneration[0] = generation
+    for logger, handler in _boundLoggers:
+        level = handler.getPocoLevel()
+        if logger.level != level: logger.setLevel(level)
@@ -0,0 +1,446 @@
+// Copyright (c) 2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "PothosModule.hpp"
+#include <Pothos/Plugin.hpp>
+#include <Poco/Logger.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <map>
+#include <memory>
+#include <vector>
+
+struct LogRecord
+{
+    LogRecord *next;
+    Poco::Logger *logger;
+    std::string source;
+    std::string text;
+    Poco::Message::Priority prio;
+};
+
+//! log the dropped record count of a finished window
+static void logDropped(Poco::Logger *logger, const long long dropped)
+{
+    logger->log(Poco::Message("Pothos.LogHandler", "dropped " + std::to_string(dropped) +
+        " log records over the rate limit", Poco::Message::PRIO_WARNING));
+}
+
+/***********************************************************************
+ * Per-logger rate limit over one second windows:
+ * the counters are atomic so producers never take a lock,
+ * and the drainer reports drops of windows that saw no later record.
+ **********************************************************************/
+struct RateLimiter
+{
+    RateLimiter(Poco::Logger *logger, const long long rateLimit):
+        logger(logger),
+        rateLimit(rateLimit),
+        windowStart(0),
+        windowCount(0),
+        dropped(0),
+        endedDropped(0),
+        totalDropped(0)
+    {
+        return;
+    }
+
+    static long long now(void)
+    {
+        return std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    //! count the record in the current window, false when over the limit
+    bool allow(void)
+    {
+        if (rateLimit <= 0) return true;
+        const auto time = now();
+        auto start = windowStart.load();
+        if (start != time and windowStart.compare_exchange_strong(start, time))
+        {
+            windowCount = 0;
+            endedDropped += dropped.exchange(0);
+        }
+        if (++windowCount <= rateLimit) return true;
+        dropped++;
+        totalDropped++;
+        return false;
+    }
+
+    //! log the drops of ended windows, or all drops when final
+    void reportDropped(const bool final)
+    {
+        auto count = endedDropped.exchange(0);
+        if (final or windowStart != now()) count += dropped.exchange(0);
+        if (count != 0) logDropped(logger, count);
+    }
+
+    Poco::Logger *const logger;
+    const long long rateLimit; //records per second, zero for no limit
+    std::atomic<long long> windowStart;
+    std::atomic<long long> windowCount;
+    std::atomic<long long> dropped; //in the current window
+    std::atomic<long long> endedDropped; //in ended windows, not yet logged
+    std::atomic<long long> totalDropped; //since creation
+};
+
+/***********************************************************************
+ * Lock-free multi-producer queue of log records:
+ * producers push onto an atomic stack, the drainer takes the whole
+ * stack at once and reverses it back into arrival order.
+ **********************************************************************/
+//! compare the watched Poco levels, defined with the level helpers below
+static void scanLoggerLevels(void);
+
+class LogDrainer
+{
+public:
+    LogDrainer(void):
+        _head(nullptr),
+        _stop(false),
+        _stopped(false)
+    {
+        return;
+    }
+
+    ~LogDrainer(void)
+    {
+        this->stop();
+    }
+
+    //! push a record, wake the drainer when the queue was empty
+    void push(LogRecord *record)
+    {
+        if (not _stopped) this->start();
+        record->next = _head.load(std::memory_order_relaxed);
+        while (not _head.compare_exchange_weak(record->next, record)){}
+
+        //without the drainer thread, records pushed after stop are logged here
+        if (_stopped) this->drain();
+        else if (record->next == nullptr) _cond.notify_one();
+    }
+
+    //! log all queued records into their Poco loggers
+    void drain(void)
+    {
+        std::lock_guard<std::mutex> lock(_drainMutex);
+        LogRecord *reversed = _head.exchange(nullptr);
+        LogRecord *records = nullptr;
+        while (reversed != nullptr)
+        {
+            auto next = reversed->next;
+            reversed->next = records;
+            records = reversed;
+            reversed = next;
+        }
+        while (records != nullptr)
+        {
+            auto next = records->next;
+            records->logger->log(Poco::Message(records->source, records->text, records->prio));
+            delete records;
+            records = next;
+        }
+    }
+
+    //! report drops from the rate limiter on each drainer tick
+    void watch(const std::shared_ptr<RateLimiter> &limiter)
+    {
+        std::lock_guard<std::mutex> lock(_limitersMutex);
+        _limiters.push_back(limiter);
+    }
+
+    //! start the drainer thread, it also scans the watched levels on each tick
+    void start(void)
+    {
+        std::call_once(_started, [this](void)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (not _stop) _thread = std::thread(&LogDrainer::run, this);
+        });
+    }
+
+    //! stop the drainer thread after logging the remaining records
+    void stop(void)
+    {
+        _stopped = true;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _cond.notify_one();
+        if (_thread.joinable()) _thread.join();
+        this->drain();
+        this->reportDropped(true);
+    }
+
+private:
+    void reportDropped(const bool final)
+    {
+        std::lock_guard<std::mutex> lock(_limitersMutex);
+        for (auto it = _limiters.begin(); it != _limiters.end();)
+        {
+            auto limiter = it->lock();
+            if (not limiter) it = _limiters.erase(it);
+            else
+            {
+                limiter->reportDropped(final);
+                ++it;
+            }
+        }
+    }
+
+    void run(void)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (not _stop)
+        {
+            //the timeout bounds the latency of a missed wakeup and of drop reports
+            _cond.wait_for(lock, std::chrono::milliseconds(100), [this](void)
+            {
+                return _stop or _head.load(std::memory_order_relaxed) != nullptr;
+            });
+            lock.unlock();
+            this->drain();
+            this->reportDropped(false);
+            scanLoggerLevels();
+            lock.lock();
+        }
+    }
+
+    std::atomic<LogRecord *> _head;
+    bool _stop;
+    std::atomic<bool> _stopped;
+    std::once_flag _started;
+    std::mutex _mutex;
+    std::mutex _drainMutex;
+    std::condition_variable _cond;
+    std::thread _thread;
+    std::mutex _limitersMutex;
+    std::vector<std::weak_ptr<RateLimiter>> _limiters;
+};
+
+static LogDrainer &getLogDrainer(void)
+{
+    static LogDrainer drainer;
+    return drainer;
+}
+
+static void stopLogDrainer(void)
+{
+    getLogDrainer().stop();
+}
+
+/***********************************************************************
+ * Python log levels to Poco priorities
+ **********************************************************************/
+static Poco::Message::Priority levelToPrio(const long level)
+{
+    if (level >= 50) return Poco::Message::PRIO_CRITICAL;
+    if (level >= 40) return Poco::Message::PRIO_ERROR;
+    if (level >= 30) return Poco::Message::PRIO_WARNING;
+    if (level >= 20) return Poco::Message::PRIO_INFORMATION;
+    return Poco::Message::PRIO_DEBUG;
+}
+
+//! the lowest python level that the Poco logger accepts after levelToPrio()
+static long pocoLevelToPyLevel(const int level)
+{
+    if (level < Poco::Message::PRIO_CRITICAL) return 51;
+    if (level < Poco::Message::PRIO_ERROR) return 50;
+    if (level < Poco::Message::PRIO_WARNING) return 40;
+    if (level < Poco::Message::PRIO_INFORMATION) return 30;
+    if (level < Poco::Message::PRIO_DEBUG) return 20;
+    return 1; //zero is NOTSET in python
+}
+
+/***********************************************************************
+ * Poco level change detection:
+ * Poco has no change notification, so the levels of the loggers
+ * used by async loggers are compared against their last seen value.
+ **********************************************************************/
+static std::mutex watchedLevelsMutex;
+static std::map<Poco::Logger *, int> watchedLevels;
+static std::atomic<long long> levelGeneration(0);
+
+static void watchLoggerLevel(Poco::Logger *logger)
+{
+    {
+        std::lock_guard<std::mutex> lock(watchedLevelsMutex);
+        watchedLevels.emplace(logger, logger->getLevel());
+    }
+
+    //level changes are seen by the drainer tick even without records
+    getLogDrainer().start();
+}
+
+static void scanLoggerLevels(void)
+{
+    std::lock_guard<std::mutex> lock(watchedLevelsMutex);
+    for (auto &pair : watchedLevels)
+    {
+        const int level = pair.first->getLevel();
+        if (level == pair.second) continue;
+        pair.second = level;
+        levelGeneration++;
+    }
+}
+
+PyObject *PothosModule_getLogLevelGeneration(PyObject *, PyObject *args)
+{
+    //without a scan, this is the count as of the last drainer tick
+    int scan = 1;
+    if (not PyArg_ParseTuple(args, "|i", &scan)) return nullptr;
+    if (scan != 0) scanLoggerLevels();
+    return PyLong_FromLongLong(levelGeneration);
+}
+
+PyObject *PothosModule_getLogLevel(PyObject *, PyObject *args)
+{
+    const char *name = nullptr;
+    if (not PyArg_ParseTuple(args, "s", &name)) return nullptr;
+    auto logger = &Poco::Logger::get(name);
+    watchLoggerLevel(logger);
+    return PyLong_FromLong(pocoLevelToPyLevel(logger->getLevel()));
+}
+
+/***********************************************************************
+ * Async logger type: one per Poco logger name
+ **********************************************************************/
+struct AsyncLoggerObject
+{
+    PyObject_HEAD
+    std::shared_ptr<RateLimiter> *limiter; //null until __init__
+};
+
+static void AsyncLogger_dealloc(AsyncLoggerObject *self)
+{
+    if (self->limiter != nullptr) (*self->limiter)->reportDropped(true);
+    delete self->limiter;
+    freePothosObject(reinterpret_cast<PyObject *>(self));
+}
+
+static int AsyncLogger_init(AsyncLoggerObject *self, PyObject *args, PyObject *)
+{
+    const char *name = nullptr;
+    long long rateLimit = 1000;
+    if (not PyArg_ParseTuple(args, "s|L", &name, &rateLimit)) return -1;
+    auto logger = &Poco::Logger::get(name);
+    watchLoggerLevel(logger);
+    std::shared_ptr<RateLimiter> limiter(new RateLimiter(logger, rateLimit));
+    getLogDrainer().watch(limiter);
+    delete self->limiter;
+    self->limiter = new std::shared_ptr<RateLimiter>(limiter);
+    return 0;
+}
+
+//! get the rate limiter, or set an error when __init__ was not called
+static RateLimiter *getRateLimiter(PyObject *self)
+{
+    auto limiter = reinterpret_cast<AsyncLoggerObject *>(self)->limiter;
+    if (limiter != nullptr) return limiter->get();
+    PyErr_SetString(PyExc_RuntimeError, "AsyncLogger is not initialized");
+    return nullptr;
+}
+
+static PyObject *AsyncLogger_log(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    auto limiter = getRateLimiter(self);
+    if (limiter == nullptr) return nullptr;
+    if (nargs != 3)
+    {
+        PyErr_SetString(PyExc_TypeError, "log() takes 3 arguments (source, text, level)");
+        return nullptr;
+    }
+    const long level = PyLong_AsLong(args[2]);
+    if (level == -1 and PyErr_Occurred()) return nullptr;
+    if (not limiter->allow()) Py_RETURN_NONE;
+
+    PyObjectRef source(PyObject_Str(args[0]), REF_NEW);
+    PyObjectRef text(PyObject_Str(args[1]), REF_NEW);
+    if (source.obj == nullptr or text.obj == nullptr) return nullptr;
+
+    auto record = new LogRecord();
+    record->logger = limiter->logger;
+    record->source = PyObjToStdString(source.obj);
+    record->text = PyObjToStdString(text.obj);
+    record->prio = levelToPrio(level);
+    getLogDrainer().push(record);
+    Py_RETURN_NONE;
+}
+
+static PyObject *AsyncLogger_flush(PyObject *, PyObject *)
+{
+    Py_BEGIN_ALLOW_THREADS
+    getLogDrainer().drain();
+    Py_END_ALLOW_THREADS
+    Py_RETURN_NONE;
+}
+
+static PyObject *AsyncLogger_getLevel(PyObject *self, void *)
+{
+    auto limiter = getRateLimiter(self);
+    if (limiter == nullptr) return nullptr;
+    return PyLong_FromLong(pocoLevelToPyLevel(limiter->logger->getLevel()));
+}
+
+static PyObject *AsyncLogger_getDropped(PyObject *self, void *)
+{
+    auto limiter = getRateLimiter(self);
+    if (limiter == nullptr) return nullptr;
+    return PyLong_FromLongLong(limiter->totalDropped);
+}
+
+static PyGetSetDef AsyncLogger_getset[] = {
+    {(char *)"level", (getter)AsyncLogger_getLevel, nullptr, (char *)"The lowest python level accepted by the Poco logger", nullptr},
+    {(char *)"dropped", (getter)AsyncLogger_getDropped, nullptr, (char *)"The number of records dropped over the rate limit", nullptr},
+    {nullptr}  /* Sentinel */
+};
+
+static PyMethodDef AsyncLogger_methods[] = {
+    {"log", POTHOS_PY_FASTCALL(AsyncLogger_log), "Queue a record (source, text, python level) for the Poco logger"},
+    {"flush", (PyCFunction)AsyncLogger_flush, METH_NOARGS, "Log all queued records now"},
+    {nullptr}  /* Sentinel */
+};
+
+PyObject *PothosModule_flushLogs(PyObject *self, PyObject *args)
+{
+    return AsyncLogger_flush(self, args);
+}
+
+static PyType_Slot AsyncLoggerType_slots[] = {
+    {Py_tp_new, (void *)PyType_GenericNew},
+    {Py_tp_dealloc, (void *)AsyncLogger_dealloc},
+    {Py_tp_doc, (void *)"Queue log records for a Poco logger, logged by a background thread"},
+    {Py_tp_methods, (void *)AsyncLogger_methods},
+    {Py_tp_getset, (void *)AsyncLogger_getset},
+    {Py_tp_init, (void *)AsyncLogger_init},
+    {0, nullptr}
+};
+
+static PyType_Spec AsyncLoggerType_spec = {
+    "Pothos.PothosModule.AsyncLogger",
+    sizeof(AsyncLoggerObject),
+    0,
+    Py_TPFLAGS_DEFAULT,
+    AsyncLoggerType_slots
+};
+
+int registerAsyncLoggerType(PothosModuleState &state)
+{
+    //queued records are logged before the process exits
+    static std::once_flag atExitFlag;
+    std::call_once(atExitFlag, [](void)
+    {
+        Py_AtExit(&stopLogDrainer);
+
+        //python blocks compare this count to sync their loggers without a record
+        Pothos::PluginRegistry::add("/proxy_helpers/python/log_level_generation",
+            LogLevelGenerationPtr(&levelGeneration));
+    });
+
+    return makePothosType(&AsyncLoggerType_spec, state.asyncLoggerType);
+}
@@ -0,0 +1,87 @@
+// Copyright (c) 2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "PothosModule.hpp"
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+/***********************************************************************
+ * Pothos::DType to numpy.dtype - see Pothos.Buffer.dtype_to_numpy
+ **********************************************************************/
+static PyObject *makeNumpyDTypeObject(const Pothos::DType &dtype)
+{
+    PyObjectRef numpy(PyImport_ImportModule("numpy"), REF_NEW);
+    if (numpy.obj == nullptr) throw Pothos::Exception("import numpy", getErrorString());
+
+    std::string name = dtype.name();
+    std::vector<size_t> shape;
+    if (dtype.dimension() != 1) shape.push_back(dtype.dimension());
+
+    //support numpy float-complex types
+    if (name == "complex_float32") name = "complex64";
+    else if (name == "complex_float64") name = "complex128";
+
+    //no integer complex types, make tuple
+    else if (name.compare(0, 8, "complex_") == 0)
+    {
+        name = name.substr(8);
+        shape.insert(shape.begin(), 2);
+    }
+
+    PyObjectRef shapeTuple(PyTuple_New(Py_ssize_t(shape.size())), REF_NEW);
+    for (size_t i = 0; i < shape.size(); i++)
+    {
+        PyTuple_SET_ITEM(shapeTuple.obj, Py_ssize_t(i), PyLong_FromSize_t(shape[i]));
+    }
+    PyObjectRef spec(Py_BuildValue("(sO)", name.c_str(), shapeTuple.obj), REF_NEW);
+    PyObjectRef result(PyObject_CallMethod(numpy.obj, (char *)"dtype", (char *)"(O)", spec.obj), REF_NEW);
+    if (result.obj == nullptr) throw Pothos::Exception("numpy.dtype("+dtype.toString()+")", getErrorString());
+    return result.newRef();
+}
+
+PyObject *dtypeToNumpyObject(const Pothos::DType &dtype)
+{
+    //filled once per type, the references are released with the module state
+    auto &state = getModuleState();
+    const auto key = std::make_pair(dtype.name(), dtype.dimension());
+    {
+        std::lock_guard<PyStateMutex> lock(state.numpyDTypesMutex);
+        auto it = state.numpyDTypes.find(key);
+        if (it != state.numpyDTypes.end()) return it->second.newRef();
+    }
+
+    //create outside of the lock, a racing thread may have inserted first
+    PyObjectRef numpyDType(makeNumpyDTypeObject(dtype), REF_NEW);
+    std::lock_guard<PyStateMutex> lock(state.numpyDTypesMutex);
+    return state.numpyDTypes.emplace(key, numpyDType).first->second.newRef();
+}
+
+//! strings and managed DType proxies skip the conversion through the python environment
+static Pothos::DType pyObjectToDType(PyObject *obj)
+{
+    #if PY_MAJOR_VERSION >= 3
+    if (PyUnicode_Check(obj)) return Pothos::DType(PyObjToStdString(obj));
+    #else
+    if (PyString_Check(obj)) return Pothos::DType(PyObjToStdString(obj));
+    #endif
+    if (isProxyObject(obj)) return reinterpret_cast<ProxyObject *>(obj)->proxy->convert<Pothos::DType>();
+    return PyObjectToProxy(obj).convert<Pothos::DType>();
+}
+
+PyObject *PothosModule_dtypeToNumpy(PyObject *, PyObject *args)
+{
+    PyObject *arg = nullptr;
+    if (not PyArg_ParseTuple(args, "O", &arg)) return nullptr;
+    try
+    {
+        return dtypeToNumpyObject(pyObjectToDType(arg));
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        PyErr_SetString(PyExc_RuntimeError, ex.displayText().c_str());
+        return nullptr;
+    }
+}
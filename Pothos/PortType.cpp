@@ -0,0 +1,466 @@
+// Copyright (c) 2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "PothosModule.hpp"
+#include <Pothos/Framework.hpp>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+/***********************************************************************
+ * common port helpers
+ **********************************************************************/
+static bool checkNumArgs(const char *name, const Py_ssize_t nargs, const Py_ssize_t expected)
+{
+    if (nargs == expected) return true;
+    PyErr_Format(PyExc_TypeError, "%s() takes %d argument(s) (%d given)", name, int(expected), int(nargs));
+    return false;
+}
+
+static bool getNumElements(PyObject *arg, size_t &num)
+{
+    const Py_ssize_t n = PyNumber_AsSsize_t(arg, PyExc_OverflowError);
+    if (n == -1 and PyErr_Occurred()) return false;
+    if (n < 0)
+    {
+        PyErr_SetString(PyExc_ValueError, "number of elements must be non-negative");
+        return false;
+    }
+    num = size_t(n);
+    return true;
+}
+
+//! convert every item up front so the port is only touched once the batch is valid
+template <typename T, typename Fcn>
+static bool convertBatch(PyObject *iterable, std::vector<T> &batch, Fcn convert)
+{
+    //a tuple snapshot owns the items, conversion can release the GIL
+    //and another thread could otherwise mutate a list that is iterated
+    PyObjectRef tuple(PySequence_Tuple(iterable), REF_NEW);
+    if (tuple.obj == nullptr) return false;
+    const Py_ssize_t num = PyTuple_GET_SIZE(tuple.obj);
+    batch.reserve(size_t(num));
+    for (Py_ssize_t i = 0; i < num; i++) batch.push_back(convert(PyTuple_GET_ITEM(tuple.obj, i)));
+    return true;
+}
+
+static Pothos::Object pyObjectToObject(PyObject *obj)
+{
+    return PyObjectToProxy(obj).toObject();
+}
+
+template <typename PortObject, typename PortType>
+static int Port_init(PortObject *self, PyObject *args, PyObject *)
+{
+    PyObject *proxy = nullptr;
+    if (not PyArg_ParseTuple(args, "O", &proxy)) return -1;
+    if (not isProxyObject(proxy))
+    {
+        PyErr_SetString(PyExc_TypeError, "expected a PothosProxy to a port");
+        return -1;
+    }
+    try
+    {
+        self->port = reinterpret_cast<ProxyObject *>(proxy)->proxy->toObject().extract<PortType *>();
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        PyErr_SetString(PyExc_RuntimeError, ex.displayText().c_str());
+        return -1;
+    }
+    Py_INCREF(proxy);
+    Py_XDECREF(self->proxy);
+    self->proxy = proxy;
+    return 0;
+}
+
+template <typename PortObject>
+static void Port_dealloc(PortObject *self)
+{
+    Py_XDECREF(self->proxy);
+    freePothosObject((PyObject *)self);
+}
+
+//! unknown attributes fall back to a call on the port proxy
+template <typename PortObject>
+static PyObject *Port_getattr(PortObject *self, PyObject *attr_name)
+{
+    PyObject *attr = PyObject_GenericGetAttr((PyObject *)self, attr_name);
+    if (attr != nullptr or self->proxy == nullptr) return attr;
+    if (not PyErr_ExceptionMatches(PyExc_AttributeError)) return nullptr;
+    PyErr_Clear();
+    PyObjectRef args(PyTuple_Pack(2, self->proxy, attr_name), REF_NEW);
+    return makeProxyCallObject(args.obj);
+}
+
+/***********************************************************************
+ * Pothos::InputPort methods
+ **********************************************************************/
+static Pothos::InputPort *getInputPort(PyObject *self)
+{
+    auto port = reinterpret_cast<InputPortObject *>(self)->port;
+    if (port == nullptr) PyErr_SetString(PyExc_RuntimeError, "PothosInputPort not initialized");
+    return port;
+}
+
+static PyObject *InputPort_elements(PyObject *self, PyObject *const *, Py_ssize_t nargs)
+{
+    if (not checkNumArgs("elements", nargs, 0)) return nullptr;
+    auto port = getInputPort(self);
+    if (port == nullptr) return nullptr;
+    return PyLong_FromSize_t(port->elements());
+}
+
+static PyObject *InputPort_consume(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    if (not checkNumArgs("consume", nargs, 1)) return nullptr;
+    auto port = getInputPort(self);
+    size_t num(0);
+    if (port == nullptr or not getNumElements(args[0], num)) return nullptr;
+    port->consume(num);
+    Py_RETURN_NONE;
+}
+
+static PyObject *InputPort_buffer(PyObject *self, PyObject *const *, Py_ssize_t nargs)
+{
+    if (not checkNumArgs("buffer", nargs, 0)) return nullptr;
+    auto port = getInputPort(self);
+    if (port == nullptr) return nullptr;
+    try
+    {
+        return makeBufferChunkArrayObject(port->buffer());
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        PyErr_SetString(PyExc_RuntimeError, ex.displayText().c_str());
+        return nullptr;
+    }
+}
+
+static PyObject *InputPort_hasMessage(PyObject *self, PyObject *const *, Py_ssize_t nargs)
+{
+    if (not checkNumArgs("hasMessage", nargs, 0)) return nullptr;
+    auto port = getInputPort(self);
+    if (port == nullptr) return nullptr;
+    return PyBool_FromLong(port->hasMessage()? 1 : 0);
+}
+
+static PyObject *InputPort_popMessage(PyObject *self, PyObject *const *, Py_ssize_t nargs)
+{
+    if (not checkNumArgs("popMessage", nargs, 0)) return nullptr;
+    auto port = getInputPort(self);
+    if (port == nullptr) return nullptr;
+    try
+    {
+        return translateObjectToPyObject(port->popMessage());
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        PyErr_SetString(PyExc_RuntimeError, ex.displayText().c_str());
+        return nullptr;
+    }
+}
+
+static PyObject *InputPort_labels(PyObject *self, PyObject *const *, Py_ssize_t nargs)
+{
+    if (not checkNumArgs("labels", nargs, 0)) return nullptr;
+    auto port = getInputPort(self);
+    if (port == nullptr) return nullptr;
+
+    //snapshot the whole range at once: one native object per label
+    const auto &labels = port->labels();
+    PyObjectRef result(PyTuple_New(Py_ssize_t(std::distance(labels.begin(), labels.end()))), REF_NEW);
+    if (result.obj == nullptr) return nullptr;
+    Py_ssize_t i = 0;
+    for (const auto &label : labels)
+    {
+        auto labelObj = makeLabelObject(label);
+        if (labelObj == nullptr) return nullptr;
+        PyTuple_SET_ITEM(result.obj, i++, labelObj);
+    }
+    return result.newRef();
+}
+
+static PyObject *InputPort_removeLabel(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    if (not checkNumArgs("removeLabel", nargs, 1)) return nullptr;
+    auto port = getInputPort(self);
+    if (port == nullptr) return nullptr;
+    try
+    {
+        port->removeLabel(pyObjectToLabel(args[0]));
+        Py_RETURN_NONE;
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        PyErr_SetString(PyExc_RuntimeError, ex.displayText().c_str());
+        return nullptr;
+    }
+}
+
+static PyObject *InputPort_removeLabels(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    if (not checkNumArgs("removeLabels", nargs, 1)) return nullptr;
+    auto port = getInputPort(self);
+    if (port == nullptr) return nullptr;
+    try
+    {
+        std::vector<Pothos::Label> labels;
+        if (not convertBatch(args[0], labels, &pyObjectToLabel)) return nullptr;
+        for (const auto &label : labels) port->removeLabel(label);
+        Py_RETURN_NONE;
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        PyErr_SetString(PyExc_RuntimeError, ex.displayText().c_str());
+        return nullptr;
+    }
+}
+
+static PyObject *InputPort_popMessages(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    if (not checkNumArgs("popMessages", nargs, 1)) return nullptr;
+    auto port = getInputPort(self);
+    size_t maxNum(0);
+    if (port == nullptr or not getNumElements(args[0], maxNum)) return nullptr;
+    try
+    {
+        std::vector<Pothos::Object> messages;
+        while (messages.size() < maxNum and port->hasMessage())
+        {
+            messages.push_back(port->popMessage());
+        }
+
+        PyObjectRef result(PyList_New(Py_ssize_t(messages.size())), REF_NEW);
+        if (result.obj == nullptr) return nullptr;
+        for (size_t i = 0; i < messages.size(); i++)
+        {
+            PyList_SET_ITEM(result.obj, Py_ssize_t(i), translateObjectToPyObject(messages[i]));
+        }
+        return result.newRef();
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        PyErr_SetString(PyExc_RuntimeError, ex.displayText().c_str());
+        return nullptr;
+    }
+}
+
+static PyObject *InputPort_dtype(PyObject *self, PyObject *const *, Py_ssize_t nargs)
+{
+    if (not checkNumArgs("dtype", nargs, 0)) return nullptr;
+    auto port = getInputPort(self);
+    if (port == nullptr) return nullptr;
+    try
+    {
+        return dtypeToNumpyObject(port->dtype());
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        PyErr_SetString(PyExc_RuntimeError, ex.displayText().c_str());
+        return nullptr;
+    }
+}
+
+static PyMethodDef InputPort_methods[] = {
+    {"elements", POTHOS_PY_FASTCALL(InputPort_elements), "Get the number of available elements"},
+    {"consume", POTHOS_PY_FASTCALL(InputPort_consume), "Consume elements from the input buffer"},
+    {"buffer", POTHOS_PY_FASTCALL(InputPort_buffer), "Get the input buffer as a numpy array"},
+    {"hasMessage", POTHOS_PY_FASTCALL(InputPort_hasMessage), "Is there a message available?"},
+    {"popMessage", POTHOS_PY_FASTCALL(InputPort_popMessage), "Remove and return the next message"},
+    {"labels", POTHOS_PY_FASTCALL(InputPort_labels), "Get a tuple snapshot of the available labels"},
+    {"removeLabel", POTHOS_PY_FASTCALL(InputPort_removeLabel), "Remove a label from the input port"},
+    {"removeLabels", POTHOS_PY_FASTCALL(InputPort_removeLabels), "Remove an iterable of labels from the input port"},
+    {"popMessages", POTHOS_PY_FASTCALL(InputPort_popMessages), "Remove and return a list of up to max messages"},
+    {"dtype", POTHOS_PY_FASTCALL(InputPort_dtype), "Get the port data type as a numpy.dtype"},
+    {nullptr}  /* Sentinel */
+};
+
+/***********************************************************************
+ * Pothos::OutputPort methods
+ **********************************************************************/
+static Pothos::OutputPort *getOutputPort(PyObject *self)
+{
+    auto port = reinterpret_cast<OutputPortObject *>(self)->port;
+    if (port == nullptr) PyErr_SetString(PyExc_RuntimeError, "PothosOutputPort not initialized");
+    return port;
+}
+
+static PyObject *OutputPort_elements(PyObject *self, PyObject *const *, Py_ssize_t nargs)
+{
+    if (not checkNumArgs("elements", nargs, 0)) return nullptr;
+    auto port = getOutputPort(self);
+    if (port == nullptr) return nullptr;
+    return PyLong_FromSize_t(port->elements());
+}
+
+static PyObject *OutputPort_produce(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    if (not checkNumArgs("produce", nargs, 1)) return nullptr;
+    auto port = getOutputPort(self);
+    size_t num(0);
+    if (port == nullptr or not getNumElements(args[0], num)) return nullptr;
+    port->produce(num);
+    Py_RETURN_NONE;
+}
+
+static PyObject *OutputPort_buffer(PyObject *self, PyObject *const *, Py_ssize_t nargs)
+{
+    if (not checkNumArgs("buffer", nargs, 0)) return nullptr;
+    auto port = getOutputPort(self);
+    if (port == nullptr) return nullptr;
+    try
+    {
+        return makeBufferChunkArrayObject(port->buffer());
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        PyErr_SetString(PyExc_RuntimeError, ex.displayText().c_str());
+        return nullptr;
+    }
+}
+
+static PyObject *OutputPort_postMessage(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    if (not checkNumArgs("postMessage", nargs, 1)) return nullptr;
+    auto port = getOutputPort(self);
+    if (port == nullptr) return nullptr;
+    try
+    {
+        port->postMessage(PyObjectToProxy(args[0]).toObject());
+        Py_RETURN_NONE;
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        PyErr_SetString(PyExc_RuntimeError, ex.displayText().c_str());
+        return nullptr;
+    }
+}
+
+static PyObject *OutputPort_postLabel(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    if (not checkNumArgs("postLabel", nargs, 1)) return nullptr;
+    auto port = getOutputPort(self);
+    if (port == nullptr) return nullptr;
+    try
+    {
+        port->postLabel(pyObjectToLabel(args[0]));
+        Py_RETURN_NONE;
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        PyErr_SetString(PyExc_RuntimeError, ex.displayText().c_str());
+        return nullptr;
+    }
+}
+
+static PyObject *OutputPort_postLabels(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    if (not checkNumArgs("postLabels", nargs, 1)) return nullptr;
+    auto port = getOutputPort(self);
+    if (port == nullptr) return nullptr;
+    try
+    {
+        std::vector<Pothos::Label> labels;
+        if (not convertBatch(args[0], labels, &pyObjectToLabel)) return nullptr;
+        for (auto &label : labels) port->postLabel(std::move(label));
+        Py_RETURN_NONE;
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        PyErr_SetString(PyExc_RuntimeError, ex.displayText().c_str());
+        return nullptr;
+    }
+}
+
+static PyObject *OutputPort_postMessages(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    if (not checkNumArgs("postMessages", nargs, 1)) return nullptr;
+    auto port = getOutputPort(self);
+    if (port == nullptr) return nullptr;
+    try
+    {
+        std::vector<Pothos::Object> messages;
+        if (not convertBatch(args[0], messages, &pyObjectToObject)) return nullptr;
+        for (auto &message : messages) port->postMessage(std::move(message));
+        Py_RETURN_NONE;
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        PyErr_SetString(PyExc_RuntimeError, ex.displayText().c_str());
+        return nullptr;
+    }
+}
+
+static PyObject *OutputPort_dtype(PyObject *self, PyObject *const *, Py_ssize_t nargs)
+{
+    if (not checkNumArgs("dtype", nargs, 0)) return nullptr;
+    auto port = getOutputPort(self);
+    if (port == nullptr) return nullptr;
+    try
+    {
+        return dtypeToNumpyObject(port->dtype());
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        PyErr_SetString(PyExc_RuntimeError, ex.displayText().c_str());
+        return nullptr;
+    }
+}
+
+static PyMethodDef OutputPort_methods[] = {
+    {"elements", POTHOS_PY_FASTCALL(OutputPort_elements), "Get the number of available elements"},
+    {"produce", POTHOS_PY_FASTCALL(OutputPort_produce), "Produce elements into the output buffer"},
+    {"buffer", POTHOS_PY_FASTCALL(OutputPort_buffer), "Get the output buffer as a numpy array"},
+    {"postMessage", POTHOS_PY_FASTCALL(OutputPort_postMessage), "Post a message to the subscribers"},
+    {"postLabel", POTHOS_PY_FASTCALL(OutputPort_postLabel), "Post a label to the output buffer"},
+    {"postMessages", POTHOS_PY_FASTCALL(OutputPort_postMessages), "Post an iterable of messages to the subscribers"},
+    {"postLabels", POTHOS_PY_FASTCALL(OutputPort_postLabels), "Post an iterable of labels to the output buffer"},
+    {"dtype", POTHOS_PY_FASTCALL(OutputPort_dtype), "Get the port data type as a numpy.dtype"},
+    {nullptr}  /* Sentinel */
+};
+
+/***********************************************************************
+ * type registration
+ **********************************************************************/
+static PyType_Slot InputPortType_slots[] = {
+    {Py_tp_new, (void *)PyType_GenericNew},
+    {Py_tp_dealloc, (void *)Port_dealloc<InputPortObject>},
+    {Py_tp_doc, (void *)"Pothos InputPort binding"},
+    {Py_tp_methods, (void *)InputPort_methods},
+    {Py_tp_init, (void *)Port_init<InputPortObject, Pothos::InputPort>},
+    {Py_tp_getattro, (void *)Port_getattr<InputPortObject>},
+    {0, nullptr}
+};
+
+static PyType_Spec InputPortType_spec = {
+    "Pothos.PothosModule.InputPort",
+    sizeof(InputPortObject),
+    0,
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    InputPortType_slots
+};
+
+static PyType_Slot OutputPortType_slots[] = {
+    {Py_tp_new, (void *)PyType_GenericNew},
+    {Py_tp_dealloc, (void *)Port_dealloc<OutputPortObject>},
+    {Py_tp_doc, (void *)"Pothos OutputPort binding"},
+    {Py_tp_methods, (void *)OutputPort_methods},
+    {Py_tp_init, (void *)Port_init<OutputPortObject, Pothos::OutputPort>},
+    {Py_tp_getattro, (void *)Port_getattr<OutputPortObject>},
+    {0, nullptr}
+};
+
+static PyType_Spec OutputPortType_spec = {
+    "Pothos.PothosModule.OutputPort",
+    sizeof(OutputPortObject),
+    0,
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    OutputPortType_slots
+};
+
+int registerPortTypes(PothosModuleState &state)
+{
+    if (makePothosType(&InputPortType_spec, state.inputPortType) < 0) return -1;
+    return makePothosType(&OutputPortType_spec, state.outputPortType);
+}
@@ -5,13 +5,14 @@
 #include <Pothos/Plugin.hpp>
 #include <Pothos/Init.hpp>
 #include <iostream>
+#include <atomic>
 #include <cassert>
 #include <cstdlib>
+#include <vector>
 
 /***********************************************************************
  * module utility converters
  **********************************************************************/
-static Pothos::ProxyEnvironment::Sptr myPythonProxyEnv;
 static PyObjectToProxyFcn myPyObjectToProxyFcn;
 static ProxyToPyObjectFcn myProxyToPyObjectFcn;
 
@@ -21,7 +22,6 @@ static void initPyObjectUtilityConverters(void)
     {
         Pothos::init(); //init here in case python is the caller
         std::atexit(&Pothos::deinit);
-        myPythonProxyEnv = Pothos::ProxyEnvironment::make("python");
         myPyObjectToProxyFcn = Pothos::PluginRegistry::get("/proxy_helpers/python/pyobject_to_proxy").getObject().extract<PyObjectToProxyFcn>();
         myProxyToPyObjectFcn = Pothos::PluginRegistry::get("/proxy_helpers/python/proxy_to_pyobject").getObject().extract<ProxyToPyObjectFcn>();
         registerPothosModuleConverters();
@@ -32,19 +32,102 @@ static void initPyObjectUtilityConverters(void)
     }
 }
 
+/***********************************************************************
+ * Module states by interpreter: the generation changes whenever
+ * a state is created or freed, which invalidates the per-thread cache.
+ **********************************************************************/
+static std::mutex moduleStatesMutex;
+static std::map<PyInterpreterState *, PothosModuleState *> moduleStates;
+static std::atomic<size_t> moduleStatesGeneration(0);
+
+static PyInterpreterState *currentInterpreter(void)
+{
+    #if PY_VERSION_HEX >= 0x03090000
+    return PyInterpreterState_Get();
+    #else
+    return PyThreadState_Get()->interp;
+    #endif
+}
+
+PothosModuleState &getModuleState(void)
+{
+    struct CachedState
+    {
+        PyInterpreterState *interp;
+        size_t generation;
+        PothosModuleState *state;
+    };
+    static thread_local CachedState cached = {nullptr, 0, nullptr};
+
+    auto interp = currentInterpreter();
+    const size_t generation = moduleStatesGeneration.load(std::memory_order_acquire);
+    if (cached.interp == interp and cached.generation == generation) return *cached.state;
+
+    std::lock_guard<std::mutex> lock(moduleStatesMutex);
+    auto it = moduleStates.find(interp);
+    if (it == moduleStates.end()) throw Pothos::Exception("getModuleState()", "PothosModule not imported in this interpreter");
+    cached.interp = interp;
+    cached.generation = moduleStatesGeneration.load(std::memory_order_relaxed);
+    cached.state = it->second;
+    return *it->second;
+}
+
+//! get or create the state for the current interpreter
+static PothosModuleState *acquireModuleState(bool &created)
+{
+    std::lock_guard<std::mutex> lock(moduleStatesMutex);
+    auto &state = moduleStates[currentInterpreter()];
+    created = (state == nullptr);
+    if (created)
+    {
+        state = new PothosModuleState();
+        moduleStatesGeneration++;
+    }
+    state->users++;
+    return state;
+}
+
+static void releaseModuleState(PothosModuleState *state)
+{
+    {
+        std::lock_guard<std::mutex> lock(moduleStatesMutex);
+        if (--state->users != 0) return;
+        for (auto it = moduleStates.begin(); it != moduleStates.end(); ++it)
+        {
+            if (it->second != state) continue;
+            moduleStates.erase(it);
+            break;
+        }
+        moduleStatesGeneration++;
+    }
+    delete state; //python objects are released with the GIL held
+}
+
 static void handlePythonPluginEvent(const Pothos::Plugin &plugin, const std::string &event)
 {
-    if (event == "remove" and plugin.getPath() == Pothos::PluginPath("/proxy_helpers/python/pyobject_to_proxy"))
+    const bool removeFromProxy = event == "remove" and plugin.getPath() == Pothos::PluginPath("/proxy_helpers/python/pyobject_to_proxy");
+    const bool removeToProxy = event == "remove" and plugin.getPath() == Pothos::PluginPath("/proxy_helpers/python/proxy_to_pyobject");
+    if (not removeFromProxy and not removeToProxy) return;
+
+    //the environments are released outside of the lock since they take the GIL
+    std::vector<Pothos::ProxyEnvironment::Sptr> envs;
+    {
+        std::lock_guard<std::mutex> lock(moduleStatesMutex);
+        for (auto &pair : moduleStates) envs.push_back(std::move(pair.second->env));
+    }
+    envs.clear();
+
+    if (removeFromProxy)
     {
-        myPythonProxyEnv.reset();
         myPyObjectToProxyFcn = PyObjectToProxyFcn();
         Pothos::PluginRegistry::remove("/proxy/converters/python/proxy_to_pyproxy");
+        Pothos::PluginRegistry::remove("/proxy_helpers/python/buffer_chunk/to_pyobject");
     }
-    if (event == "remove" and plugin.getPath() == Pothos::PluginPath("/proxy_helpers/python/proxy_to_pyobject"))
+    if (removeToProxy)
     {
-        myPythonProxyEnv.reset();
         myProxyToPyObjectFcn = ProxyToPyObjectFcn();
         Pothos::PluginRegistry::remove("/proxy/converters/python/pyproxy_to_proxy");
+        Pothos::PluginRegistry::remove("/proxy/converters/python/pylabel_to_label");
     }
 }
 
@@ -52,8 +135,9 @@ Pothos::Proxy PyObjectToProxy(PyObject *obj)
 {
     assert(obj != nullptr);
     if (isProxyObject(obj)) return *reinterpret_cast<ProxyObject *>(obj)->proxy;
+    auto env = getPythonProxyEnv();
     PyThreadStateLock lock;
-    return myPyObjectToProxyFcn(myPythonProxyEnv, obj);
+    return myPyObjectToProxyFcn(env, obj);
 }
 
 PyObject *ProxyToPyObject(const Pothos::Proxy &proxy)
@@ -65,7 +149,45 @@ PyObject *ProxyToPyObject(const Pothos::Proxy &proxy)
 
 Pothos::ProxyEnvironment::Sptr getPythonProxyEnv(void)
 {
-    return myPythonProxyEnv;
+    return getModuleState().env;
+}
+
+/***********************************************************************
+ * translate results into python with optional zero-copy vectors
+ **********************************************************************/
+PyObject *translateProxyToPyObject(const Pothos::Proxy &proxy)
+{
+    auto env = getPythonProxyEnv();
+    if (proxy.getEnvironment() == env) return ProxyToPyObject(proxy);
+    return translateObjectToPyObject(proxy.toObject());
+}
+
+PyObject *translateObjectToPyObject(const Pothos::Object &local)
+{
+    //view numeric vectors as numpy arrays that keep the object alive
+    auto &state = getModuleState();
+    if (state.zeroCopyVectors)
+    {
+        auto array = makeVectorArrayObject(local);
+        if (array != nullptr) return array;
+    }
+
+    return ProxyToPyObject(state.env->convertObjectToProxy(local));
+}
+
+static PyObject *PothosModule_setZeroCopyVectors(PyObject *, PyObject *args)
+{
+    PyObject *enable = nullptr;
+    if (not PyArg_ParseTuple(args, "O", &enable)) return nullptr;
+    const int r = PyObject_IsTrue(enable);
+    if (r == -1) return nullptr;
+    getModuleState().zeroCopyVectors = (r == 1);
+    Py_RETURN_NONE;
+}
+
+static PyObject *PothosModule_getZeroCopyVectors(PyObject *, PyObject *)
+{
+    return PyBool_FromLong(getModuleState().zeroCopyVectors.load());
 }
 
 /***********************************************************************
@@ -77,6 +199,12 @@ static Pothos::Proxy convertPyProxyToProxy(const Pothos::Proxy &proxy)
     return *reinterpret_cast<ProxyObject *>(ref.obj)->proxy;
 }
 
+static Pothos::Label convertPyLabelToLabel(const Pothos::Proxy &proxy)
+{
+    PyObjectRef ref(ProxyToPyObject(proxy), REF_NEW);
+    return reinterpret_cast<LabelObject *>(ref.obj)->label;
+}
+
 static Pothos::Proxy convertProxyToPyProxy(Pothos::ProxyEnvironment::Sptr env, const Pothos::Proxy &proxy)
 {
     PyObjectRef ref(makeProxyObject(proxy), REF_NEW);
@@ -90,17 +218,206 @@ void registerPothosModuleConverters(void)
     Pothos::PluginRegistry::addCall("/proxy/converters/python/proxy_to_pyproxy",
         &convertProxyToPyProxy);
     Pothos::PluginRegistry::add("/proxy/converters/python/pyproxy_to_proxy",
-        Pothos::ProxyConvertPair("PothosProxy", &convertPyProxyToProxy));
+        Pothos::ProxyConvertPair("Pothos.PothosModule.Proxy", &convertPyProxyToProxy));
+    Pothos::PluginRegistry::add("/proxy/converters/python/pylabel_to_label",
+        Pothos::ProxyConvertPair("Pothos.PothosModule.NativeLabel", &convertPyLabelToLabel));
+    Pothos::PluginRegistry::add("/proxy_helpers/python/buffer_chunk/to_pyobject",
+        BufferChunkToPyObjectFcn(&makeBufferChunkArrayObject));
 }
 
 /***********************************************************************
- * module error support
+ * type creation from specs
  **********************************************************************/
-static PyObject *PothosModuleError;
+PyObject *makePothosType(PyType_Spec *spec)
+{
+    #if PY_VERSION_HEX >= 0x03090000
+    return PyType_FromSpec(spec);
+
+    #elif PY_MAJOR_VERSION >= 3
+    //buffer procs are set on the heap type after creation
+    std::vector<PyType_Slot> slots;
+    void *getbuffer = nullptr;
+    for (auto slot = spec->slots; slot->slot != 0; slot++)
+    {
+        if (slot->slot == Py_bf_getbuffer) getbuffer = slot->pfunc;
+        else slots.push_back(*slot);
+    }
+    slots.push_back(PyType_Slot{0, nullptr});
+    PyType_Spec heapSpec = *spec;
+    heapSpec.slots = slots.data();
+    PyObject *type = PyType_FromSpec(&heapSpec);
+    if (type != nullptr and getbuffer != nullptr)
+    {
+        reinterpret_cast<PyTypeObject *>(type)->tp_as_buffer->bf_getbuffer = (getbufferproc)getbuffer;
+    }
+    return type;
+
+    #else
+    //python 2 has one interpreter, the type lives for the process
+    auto type = new PyTypeObject();
+    auto numberMethods = new PyNumberMethods();
+    auto bufferProcs = new PyBufferProcs();
+    Py_REFCNT(type) = 1;
+    type->tp_name = spec->name;
+    type->tp_basicsize = spec->basicsize;
+    type->tp_itemsize = spec->itemsize;
+    type->tp_flags = spec->flags;
+    for (auto slot = spec->slots; slot->slot != 0; slot++)
+    {
+        switch (slot->slot)
+        {
+        case Py_bf_getbuffer:
+            type->tp_as_buffer = bufferProcs;
+            type->tp_flags |= Py_TPFLAGS_HAVE_NEWBUFFER;
+            bufferProcs->bf_getbuffer = (getbufferproc)slot->pfunc; break;
+        case Py_nb_bool:
+            type->tp_as_number = numberMethods;
+            numberMethods->nb_nonzero = (inquiry)slot->pfunc; break;
+        case Py_tp_call: type->tp_call = (ternaryfunc)slot->pfunc; break;
+        case Py_tp_dealloc: type->tp_dealloc = (destructor)slot->pfunc; break;
+        case Py_tp_doc: type->tp_doc = (const char *)slot->pfunc; break;
+        case Py_tp_getattro: type->tp_getattro = (getattrofunc)slot->pfunc; break;
+        case Py_tp_getset: type->tp_getset = (PyGetSetDef *)slot->pfunc; break;
+        case Py_tp_hash: type->tp_hash = (hashfunc)slot->pfunc; break;
+        case Py_tp_init: type->tp_init = (initproc)slot->pfunc; break;
+        case Py_tp_methods: type->tp_methods = (PyMethodDef *)slot->pfunc; break;
+        case Py_tp_new: type->tp_new = (newfunc)slot->pfunc; break;
+        case Py_tp_repr: type->tp_repr = (reprfunc)slot->pfunc; break;
+        case Py_tp_richcompare: type->tp_richcompare = (richcmpfunc)slot->pfunc; break;
+        case Py_tp_setattro: type->tp_setattro = (setattrofunc)slot->pfunc; break;
+        case Py_tp_str: type->tp_str = (reprfunc)slot->pfunc; break;
+        default: break;
+        }
+    }
+    if (PyType_Ready(type) < 0) return nullptr;
+    return (PyObject *)type;
+    #endif
+}
+
+int makePothosType(PyType_Spec *spec, PyObjectRef &type)
+{
+    type = PyObjectRef(makePothosType(spec), REF_NEW);
+    return (type.obj == nullptr)? -1 : 0;
+}
 
 /***********************************************************************
  * module setup
  **********************************************************************/
+static PyMethodDef PothosModule_methods[] = {
+    {"setZeroCopyVectors", (PyCFunction)PothosModule_setZeroCopyVectors, METH_VARARGS,
+        "Return numeric std::vector results as read-only numpy arrays over the C++ storage"},
+    {"getZeroCopyVectors", (PyCFunction)PothosModule_getZeroCopyVectors, METH_NOARGS,
+        "Are numeric std::vector results returned as numpy arrays?"},
+    {"dtypeToNumpy", (PyCFunction)PothosModule_dtypeToNumpy, METH_VARARGS,
+        "Get the numpy.dtype for a Pothos::DType (cached per type)"},
+    {"flushLogs", (PyCFunction)PothosModule_flushLogs, METH_NOARGS,
+        "Log all records queued by the async loggers"},
+    {"getLogLevel", (PyCFunction)PothosModule_getLogLevel, METH_VARARGS,
+        "Get the lowest python level accepted by the named Poco logger"},
+    {"getLogLevelGeneration", (PyCFunction)PothosModule_getLogLevelGeneration, METH_VARARGS,
+        "Get a counter that changes when the Poco level of an async logger changes (scan=True)"},
+    {nullptr}  /* Sentinel */
+};
+
+//! fill in a new module state: the environment, error, and types
+static int initModuleState(PothosModuleState &state)
+{
+    try
+    {
+        #if PY_VERSION_HEX >= 0x03070000
+        state.mainInterpreter = currentInterpreter() == PyInterpreterState_Main();
+        #else
+        state.mainInterpreter = true;
+        #endif
+        state.env = Pothos::ProxyEnvironment::make("python");
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        PyErr_SetString(PyExc_ImportError, ex.displayText().c_str());
+        return -1;
+    }
+
+    state.error = PyObjectRef(PyErr_NewException((char *)"PothosModule.error", NULL, NULL), REF_NEW);
+    if (state.error.obj == nullptr) return -1;
+
+    if (registerProxyType(state) < 0) return -1;
+    if (registerProxyCallType(state) < 0) return -1;
+    if (registerProxyEnvironmentType(state) < 0) return -1;
+    if (registerSharedBufferType(state) < 0) return -1;
+    if (registerLabelType(state) < 0) return -1;
+    if (registerPortTypes(state) < 0) return -1;
+    if (registerAsyncLoggerType(state) < 0) return -1;
+    return 0;
+}
+
+//! add the interpreter's error and types to a new module object
+static int PothosModule_exec(PyObject *m)
+{
+    static std::once_flag initFlag;
+    std::call_once(initFlag, &initPyObjectUtilityConverters);
+
+    //a module created again in the same interpreter shares the state
+    bool created(false);
+    auto state = acquireModuleState(created);
+    if (created and initModuleState(*state) < 0)
+    {
+        releaseModuleState(state);
+        return -1;
+    }
+    #if PY_VERSION_HEX >= 0x03050000
+    *reinterpret_cast<PothosModuleState **>(PyModule_GetState(m)) = state;
+    #endif
+
+    const std::pair<const char *, PyObjectRef *> attrs[] = {
+        {"error", &state->error},
+        {"Proxy", &state->proxyType},
+        {"ProxyCall", &state->proxyCallType},
+        {"ProxyEnvironment", &state->proxyEnvironmentType},
+        {"SharedBuffer", &state->sharedBufferType},
+        {"NativeLabel", &state->labelType},
+        {"InputPort", &state->inputPortType},
+        {"OutputPort", &state->outputPortType},
+        {"AsyncLogger", &state->asyncLoggerType},
+    };
+    for (const auto &attr : attrs)
+    {
+        if (PyModule_AddObject(m, attr.first, attr.second->newRef()) == 0) continue;
+        Py_DECREF(attr.second->obj);
+        return -1;
+    }
+    return 0;
+}
+
+#if PY_VERSION_HEX >= 0x03050000
+static void PothosModule_free(void *m)
+{
+    auto state = reinterpret_cast<PothosModuleState **>(PyModule_GetState((PyObject *)m));
+    if (state != nullptr and *state != nullptr) releaseModuleState(*state);
+}
+
+static PyModuleDef_Slot PothosModule_slots[] = {
+    {Py_mod_exec, (void *)PothosModule_exec},
+    #if PY_VERSION_HEX >= 0x030C0000
+    {Py_mod_multiple_interpreters, Py_MOD_PER_INTERPRETER_GIL_SUPPORTED},
+    #endif
+    #if PY_VERSION_HEX >= 0x030D0000
+    {Py_mod_gil, Py_MOD_GIL_NOT_USED},
+    #endif
+    {0, nullptr}
+};
+
+static PyModuleDef PothosModule = {
+    PyModuleDef_HEAD_INIT,
+    "PothosModule",
+    "Pothos python bindings",
+    sizeof(PothosModuleState *),
+    PothosModule_methods,
+    PothosModule_slots,
+    nullptr, nullptr,
+    PothosModule_free
+};
+#endif
+
 extern "C" POTHOS_HELPER_DLL_EXPORT
 #if PY_MAJOR_VERSION >= 3
 PyObject *PyInit_PothosModule(void)
@@ -108,33 +425,24 @@ PyObject *PyInit_PothosModule(void)
 void initPothosModule(void)
 #endif
 {
-    initPyObjectUtilityConverters();
+    #if PY_VERSION_HEX >= 0x03050000
+    return PyModuleDef_Init(&PothosModule);
 
-    #if PY_MAJOR_VERSION >= 3
+    #elif PY_MAJOR_VERSION >= 3
     static PyModuleDef PothosModule = {
         PyModuleDef_HEAD_INIT,
         "PothosModule",
         "Pothos python bindings",
         -1,
-        nullptr, nullptr, nullptr, nullptr, nullptr
+        PothosModule_methods,
+        nullptr, nullptr, nullptr, nullptr
     };
     PyObject *m = PyModule_Create(&PothosModule);
-    #else
-    PyObject *m = Py_InitModule("PothosModule", nullptr);
-    #endif
-
-    if (m != nullptr)
-    {
-        PothosModuleError = PyErr_NewException((char *)"PothosModule.error", NULL, NULL);
-        Py_INCREF(PothosModuleError);
-        PyModule_AddObject(m, "error", PothosModuleError);
-
-        registerProxyType(m);
-        registerProxyCallType(m);
-        registerProxyEnvironmentType(m);
-    }
-
-    #if PY_MAJOR_VERSION >= 3
+    if (m != nullptr and PothosModule_exec(m) < 0) Py_CLEAR(m);
     return m;
+
+    #else
+    PyObject *m = Py_InitModule("PothosModule", PothosModule_methods);
+    if (m != nullptr) PothosModule_exec(m);
     #endif
 }
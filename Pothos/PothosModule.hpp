@@ -3,6 +3,26 @@
 
 #include "../PyObjectUtils.hpp"
 #include <Pothos/Proxy.hpp>
+#include <Pothos/Framework/DType.hpp>
+#include <Pothos/Framework/BufferChunk.hpp>
+#include <Pothos/Framework/Label.hpp>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+//! Use METH_FASTCALL where available, otherwise adapt METH_VARARGS
+#if PY_VERSION_HEX >= 0x03070000
+#define POTHOS_PY_FASTCALL(fcn) (PyCFunction)(void(*)(void))(fcn), METH_FASTCALL
+#else
+template <PyObject *(*Fcn)(PyObject *, PyObject *const *, Py_ssize_t)>
+PyObject *pothosPyFastcallAdapter(PyObject *self, PyObject *args)
+{
+    return Fcn(self, &PyTuple_GET_ITEM(args, 0), PyTuple_GET_SIZE(args));
+}
+#define POTHOS_PY_FASTCALL(fcn) (PyCFunction)&pothosPyFastcallAdapter<fcn>, METH_VARARGS
+#endif
 
 //! Module utility to convert between forms
 Pothos::Proxy PyObjectToProxy(PyObject *obj);
@@ -13,6 +33,12 @@ PyObject *ProxyToPyObject(const Pothos::Proxy &proxy);
 //! Access the proxy environment for python
 Pothos::ProxyEnvironment::Sptr getPythonProxyEnv(void);
 
+//! Convert a proxy from any environment into a native python object
+PyObject *translateProxyToPyObject(const Pothos::Proxy &proxy);
+
+//! Convert a local object into a native python object
+PyObject *translateObjectToPyObject(const Pothos::Object &local);
+
 //! Convert a proxy from one env into another
 inline Pothos::Proxy proxyEnvTranslate(const Pothos::Proxy &proxy, const Pothos::ProxyEnvironment::Sptr &env)
 {
@@ -22,6 +48,113 @@ inline Pothos::Proxy proxyEnvTranslate(const Pothos::Proxy &proxy, const Pothos:
 
 void registerPothosModuleConverters(void);
 
+/***********************************************************************
+ * Per-interpreter module state: each interpreter that imports the
+ * module gets its own types, python environment, and caches.
+ **********************************************************************/
+struct PothosModuleState
+{
+    PothosModuleState(void):
+        users(0),
+        mainInterpreter(false),
+        zeroCopyVectors(false)
+    {
+        return;
+    }
+
+    size_t users; //module objects in the interpreter sharing this state
+    bool mainInterpreter;
+    Pothos::ProxyEnvironment::Sptr env; //bound to this interpreter
+    std::atomic<bool> zeroCopyVectors;
+
+    PyObjectRef error;
+    PyObjectRef proxyType;
+    PyObjectRef proxyCallType;
+    PyObjectRef proxyEnvironmentType;
+    PyObjectRef sharedBufferType;
+    PyObjectRef labelType;
+    PyObjectRef inputPortType;
+    PyObjectRef outputPortType;
+    PyObjectRef asyncLoggerType;
+
+    //numpy.asarray, or memoryview where numpy cannot be imported
+    PyStateMutex asarrayMutex;
+    PyObjectRef asarray;
+
+    //numpy.dtype objects by Pothos::DType name and dimension
+    PyStateMutex numpyDTypesMutex;
+    std::map<std::pair<std::string, size_t>, PyObjectRef> numpyDTypes;
+};
+
+//! get the module state of the calling thread's interpreter (call with the GIL held)
+PothosModuleState &getModuleState(void);
+
+/***********************************************************************
+ * Type creation from specs: heap types on python 3,
+ * python 2 fills in a static type from the same spec.
+ **********************************************************************/
+#if PY_MAJOR_VERSION < 3
+struct PyType_Slot
+{
+    int slot;
+    void *pfunc;
+};
+
+struct PyType_Spec
+{
+    const char *name;
+    int basicsize;
+    int itemsize;
+    unsigned int flags;
+    PyType_Slot *slots;
+};
+
+enum
+{
+    Py_bf_getbuffer = 1,
+    Py_nb_bool,
+    Py_tp_call,
+    Py_tp_dealloc,
+    Py_tp_doc,
+    Py_tp_getattro,
+    Py_tp_getset,
+    Py_tp_hash,
+    Py_tp_init,
+    Py_tp_methods,
+    Py_tp_new,
+    Py_tp_repr,
+    Py_tp_richcompare,
+    Py_tp_setattro,
+    Py_tp_str,
+};
+#elif PY_VERSION_HEX < 0x03090000
+//! handled by makePothosType(), PyType_FromSpec() rejects it before 3.9
+#define Py_bf_getbuffer 1
+#endif
+
+//! create a type from the spec (new reference or null on error)
+PyObject *makePothosType(PyType_Spec *spec);
+
+//! create a type from the spec into the state member (0 on success)
+int makePothosType(PyType_Spec *spec, PyObjectRef &type);
+
+//! free an object in tp_dealloc, instances own a type reference since python 3.8
+inline void freePothosObject(PyObject *self)
+{
+    PyTypeObject *type = Py_TYPE(self);
+    type->tp_free(self);
+    #if PY_VERSION_HEX >= 0x03080000
+    Py_DECREF(type);
+    #endif
+}
+
+//! allocate an instance of a module type without calling __init__
+inline PyObject *allocPothosObject(const PyObjectRef &type)
+{
+    auto typeObj = reinterpret_cast<PyTypeObject *>(type.obj);
+    return typeObj->tp_alloc(typeObj, 0);
+}
+
 /***********************************************************************
  * Pothos::ProxyEnvironment support
  **********************************************************************/
@@ -31,8 +164,8 @@ struct ProxyEnvironmentObject
     Pothos::ProxyEnvironment::Sptr *env;
 };
 
-//! called by module to register type
-void registerProxyEnvironmentType(PyObject *m);
+//! called by module to create the type in its state
+int registerProxyEnvironmentType(PothosModuleState &state);
 
 //! utility for c api to construct a proxy env
 PyObject *makeProxyEnvironmentObject(const Pothos::ProxyEnvironment::Sptr &env);
@@ -49,8 +182,8 @@ struct ProxyObject
     Pothos::Proxy *proxy;
 };
 
-//! called by module to register type
-void registerProxyType(PyObject *m);
+//! called by module to create the type in its state
+int registerProxyType(PothosModuleState &state);
 
 //! utility for c api to construct a proxy
 PyObject *makeProxyObject(const Pothos::Proxy &proxy);
@@ -68,12 +201,112 @@ struct ProxyCallObject
     PyObjectRef *name;
 };
 
-//! called by module to register type
-void registerProxyCallType(PyObject *m);
+//! called by module to create the type in its state
+int registerProxyCallType(PothosModuleState &state);
 
 //! utility for c api to construct a proxy call object
 PyObject *makeProxyCallObject(PyObject *args);
 
+/***********************************************************************
+ * Buffer protocol support
+ **********************************************************************/
+struct SharedBufferObject
+{
+    PyObject_HEAD
+    Pothos::Object *container; //keeps the memory alive
+    void *address;
+    Py_ssize_t length;
+    Py_ssize_t itemsize;
+    const char *format;
+    int readonly;
+    int ndim;
+    Py_ssize_t shape[3];
+    Py_ssize_t strides[3];
+};
+
+//! called by module to create the type in its state
+int registerSharedBufferType(PothosModuleState &state);
+
+//! utility for c api to construct a buffer over memory owned by the container
+PyObject *makeSharedBufferObject(const Pothos::Object &container, const size_t address, const size_t length, const Pothos::DType &dtype, const bool readonly);
+
+//! utility for c api to view a numeric std::vector as a numpy array (nullptr when not a numeric vector)
+PyObject *makeVectorArrayObject(const Pothos::Object &obj);
+
+//! utility for c api to view a buffer chunk as a writable numpy array
+PyObject *makeBufferChunkArrayObject(const Pothos::BufferChunk &buffer);
+
+/***********************************************************************
+ * Pothos::Label support
+ **********************************************************************/
+struct LabelObject
+{
+    PyObject_HEAD
+    Pothos::Label label; //constructed in place
+};
+
+//! called by module to create the type in its state
+int registerLabelType(PothosModuleState &state);
+
+//! utility for c api to construct a native label
+PyObject *makeLabelObject(const Pothos::Label &label);
+
+//! utility for c api to check if a native label
+bool isLabelObject(PyObject *obj);
+
+//! get a label from a native label or a label proxy (throws on error)
+Pothos::Label pyObjectToLabel(PyObject *obj);
+
+/***********************************************************************
+ * Pothos::InputPort and Pothos::OutputPort support
+ **********************************************************************/
+namespace Pothos
+{
+    class InputPort;
+    class OutputPort;
+}
+
+struct InputPortObject
+{
+    PyObject_HEAD
+    PyObject *proxy; //keeps the port proxy for fallback calls
+    Pothos::InputPort *port;
+};
+
+struct OutputPortObject
+{
+    PyObject_HEAD
+    PyObject *proxy; //keeps the port proxy for fallback calls
+    Pothos::OutputPort *port;
+};
+
+//! called by module to create the port types in its state
+int registerPortTypes(PothosModuleState &state);
+
+/***********************************************************************
+ * Async logging support
+ **********************************************************************/
+//! called by module to create the type in its state
+int registerAsyncLoggerType(PothosModuleState &state);
+
+//! log all queued records now (module method)
+PyObject *PothosModule_flushLogs(PyObject *self, PyObject *args);
+
+//! the lowest python level accepted by the named Poco logger (module method)
+PyObject *PothosModule_getLogLevel(PyObject *self, PyObject *args);
+
+//! count of Poco level changes seen on async loggers (module method)
+PyObject *PothosModule_getLogLevelGeneration(PyObject *self, PyObject *args);
+
+/***********************************************************************
+ * Numpy dtype support
+ **********************************************************************/
+//! get the numpy.dtype for a Pothos::DType, cached in the module state (new reference)
+PyObject *dtypeToNumpyObject(const Pothos::DType &dtype);
+
+//! module function: dtypeToNumpy(dtype) -> numpy.dtype
+PyObject *PothosModule_dtypeToNumpy(PyObject *, PyObject *args);
+
 /***********************************************************************
  * rich compare support for old-style cmp
  **********************************************************************/
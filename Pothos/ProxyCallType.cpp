@@ -4,15 +4,11 @@
 #include "PothosModule.hpp"
 #include <cassert>
 
-static PyTypeObject ProxyCallType = {
-    PyObject_HEAD_INIT(NULL)
-};
-
 static void ProxyCall_dealloc(ProxyCallObject *self)
 {
     delete self->proxy;
     delete self->name;
-    Py_TYPE(self)->tp_free((PyObject*)self);
+    freePothosObject((PyObject *)self);
 }
 
 static int ProxyCall_init(ProxyCallObject *self, PyObject *args, PyObject *)
@@ -45,7 +41,7 @@ PyObject* ProxyCall_call(ProxyCallObject *self, PyObject *args, PyObject *)
         }
 
         //convert the result into a pyobject
-        return ProxyToPyObject(proxyEnvTranslate(proxy, getPythonProxyEnv()));
+        return translateProxyToPyObject(proxy);
     }
     catch (const Pothos::Exception &ex)
     {
@@ -56,22 +52,27 @@ PyObject* ProxyCall_call(ProxyCallObject *self, PyObject *args, PyObject *)
 
 PyObject *makeProxyCallObject(PyObject *args)
 {
-    return PyObject_CallObject((PyObject *)&ProxyCallType, args);
+    return PyObject_CallObject(getModuleState().proxyCallType.obj, args);
 }
 
-void registerProxyCallType(PyObject *m)
-{
-    ProxyCallType.tp_new = PyType_GenericNew;
-    ProxyCallType.tp_name = "PothosProxyCall";
-    ProxyCallType.tp_basicsize = sizeof(ProxyCallObject);
-    ProxyCallType.tp_dealloc = (destructor)ProxyCall_dealloc;
-    ProxyCallType.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
-    ProxyCallType.tp_doc = "Pothos Proxy Call binding";
-    ProxyCallType.tp_init = (initproc)ProxyCall_init;
-    ProxyCallType.tp_call = (ternaryfunc)ProxyCall_call;
+static PyType_Slot ProxyCallType_slots[] = {
+    {Py_tp_new, (void *)PyType_GenericNew},
+    {Py_tp_dealloc, (void *)ProxyCall_dealloc},
+    {Py_tp_doc, (void *)"Pothos Proxy Call binding"},
+    {Py_tp_init, (void *)ProxyCall_init},
+    {Py_tp_call, (void *)ProxyCall_call},
+    {0, nullptr}
+};
 
-    if (PyType_Ready(&ProxyCallType) < 0) return;
+static PyType_Spec ProxyCallType_spec = {
+    "Pothos.PothosModule.ProxyCall",
+    sizeof(ProxyCallObject),
+    0,
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    ProxyCallType_slots
+};
 
-    Py_INCREF(&ProxyCallType);
-    PyModule_AddObject(m, "ProxyCall", (PyObject *)&ProxyCallType);
+int registerProxyCallType(PothosModuleState &state)
+{
+    return makePothosType(&ProxyCallType_spec, state.proxyCallType);
 }
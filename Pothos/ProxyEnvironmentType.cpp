@@ -5,14 +5,10 @@
 #include "PothosModule.hpp"
 #include <cassert>
 
-static PyTypeObject ProxyEnvironmentType = {
-    PyObject_HEAD_INIT(NULL)
-};
-
 static void ProxyEnvironment_dealloc(ProxyEnvironmentObject *self)
 {
     delete self->env;
-    Py_TYPE(self)->tp_free((PyObject*)self);
+    freePothosObject((PyObject *)self);
 }
 
 static int ProxyEnvironment_init(ProxyEnvironmentObject *self, PyObject *args, PyObject *kwds)
@@ -133,7 +129,7 @@ static PyObject *ProxyEnvironment_convertProxyToObject(ProxyEnvironmentObject *,
     try
     {
         auto proxy = *reinterpret_cast<ProxyObject *>(arg0)->proxy;
-        return ProxyToPyObject(proxyEnvTranslate(proxy, getPythonProxyEnv()));
+        return translateProxyToPyObject(proxy);
     }
     catch (const Pothos::Exception &ex)
     {
@@ -167,7 +163,8 @@ PyObject* ProxyEnvironment_Compare(PyObject *o1, PyObject *o2, int opid)
 
 PyObject *makeProxyEnvironmentObject(const Pothos::ProxyEnvironment::Sptr &env)
 {
-    PyObject *o = PyObject_CallObject((PyObject *)&ProxyEnvironmentType, nullptr);
+    PyObject *o = PyObject_CallObject(getModuleState().proxyEnvironmentType.obj, nullptr);
+    if (o == nullptr) return nullptr;
     auto proxyObject = reinterpret_cast<ProxyEnvironmentObject *>(o);
     *(proxyObject->env) = env;
     return o;
@@ -176,23 +173,28 @@ PyObject *makeProxyEnvironmentObject(const Pothos::ProxyEnvironment::Sptr &env)
 bool isProxyEnvironmentObject(PyObject *obj)
 {
     if (obj == nullptr) return false;
-    return Py_TYPE(obj) == &ProxyEnvironmentType;
+    return Py_TYPE(obj) == reinterpret_cast<PyTypeObject *>(getModuleState().proxyEnvironmentType.obj);
 }
 
-void registerProxyEnvironmentType(PyObject *m)
+static PyType_Slot ProxyEnvironmentType_slots[] = {
+    {Py_tp_new, (void *)PyType_GenericNew},
+    {Py_tp_dealloc, (void *)ProxyEnvironment_dealloc},
+    {Py_tp_richcompare, (void *)ProxyEnvironment_Compare},
+    {Py_tp_doc, (void *)"Pothos ProxyEnvironment binding"},
+    {Py_tp_methods, (void *)ProxyEnvironment_methods},
+    {Py_tp_init, (void *)ProxyEnvironment_init},
+    {0, nullptr}
+};
+
+static PyType_Spec ProxyEnvironmentType_spec = {
+    "Pothos.PothosModule.ProxyEnvironment",
+    sizeof(ProxyEnvironmentObject),
+    0,
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    ProxyEnvironmentType_slots
+};
+
+int registerProxyEnvironmentType(PothosModuleState &state)
 {
-    ProxyEnvironmentType.tp_new = PyType_GenericNew;
-    ProxyEnvironmentType.tp_name = "PothosProxyEnvironment";
-    ProxyEnvironmentType.tp_basicsize = sizeof(ProxyEnvironmentObject);
-    ProxyEnvironmentType.tp_dealloc = (destructor)ProxyEnvironment_dealloc;
-    ProxyEnvironmentType.tp_richcompare = (richcmpfunc)ProxyEnvironment_Compare;
-    ProxyEnvironmentType.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
-    ProxyEnvironmentType.tp_doc = "Pothos ProxyEnvironment binding";
-    ProxyEnvironmentType.tp_methods = ProxyEnvironment_methods;
-    ProxyEnvironmentType.tp_init = (initproc)ProxyEnvironment_init;
-
-    if (PyType_Ready(&ProxyEnvironmentType) < 0) return;
-
-    Py_INCREF(&ProxyEnvironmentType);
-    PyModule_AddObject(m, "ProxyEnvironment", (PyObject *)&ProxyEnvironmentType);
+    return makePothosType(&ProxyEnvironmentType_spec, state.proxyEnvironmentType);
 }
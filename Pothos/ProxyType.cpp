@@ -5,17 +5,10 @@
 #include "PothosModule.hpp"
 #include <cassert>
 
-static PyTypeObject ProxyType = {
-    PyObject_HEAD_INIT(NULL)
-};
-
-static PyNumberMethods ProxyNumberMethods = {
-};
-
 static void Proxy_dealloc(ProxyObject *self)
 {
     delete self->proxy;
-    Py_TYPE(self)->tp_free((PyObject*)self);
+    freePothosObject((PyObject *)self);
 }
 
 static int Proxy_init(ProxyObject *self, PyObject *args, PyObject *)
@@ -58,7 +51,7 @@ static PyObject* Proxy_getattr(PyObject *self, PyObject *attr_name)
         }
 
         //convert the result into a pyobject
-        return ProxyToPyObject(proxyEnvTranslate(proxy, getPythonProxyEnv()));
+        return translateProxyToPyObject(proxy);
     }
     catch (const Pothos::Exception &) {}
 
@@ -100,7 +93,7 @@ static PyObject *Proxy_convert(ProxyObject *self, PyObject *)
 {
     try
     {
-        return ProxyToPyObject(proxyEnvTranslate(*self->proxy, getPythonProxyEnv()));
+        return translateProxyToPyObject(*self->proxy);
     }
     catch (const Pothos::Exception &ex)
     {
@@ -153,7 +146,7 @@ static PyObject *Proxy_call(ProxyObject *self, PyObject *args)
     try
     {
         auto proxy = Proxy_callProxyHelper(self, args);
-        return ProxyToPyObject(proxyEnvTranslate(proxy, getPythonProxyEnv()));
+        return translateProxyToPyObject(proxy);
     }
     catch (const Pothos::Exception &ex)
     {
@@ -167,7 +160,7 @@ static PyObject *Proxy_callFunc(ProxyObject *self, PyObject *args, PyObject *)
     try
     {
         auto proxy = Proxy_callProxyHelper(self, "()", args);
-        return ProxyToPyObject(proxyEnvTranslate(proxy, getPythonProxyEnv()));
+        return translateProxyToPyObject(proxy);
     }
     catch (const Pothos::Exception &ex)
     {
@@ -237,7 +230,8 @@ static PyObject *Proxy_toString(ProxyObject *self)
 
 PyObject *makeProxyObject(const Pothos::Proxy &proxy)
 {
-    PyObject *o = PyObject_CallObject((PyObject *)&ProxyType, nullptr);
+    PyObject *o = PyObject_CallObject(getModuleState().proxyType.obj, nullptr);
+    if (o == nullptr) return nullptr;
     auto proxyObject = reinterpret_cast<ProxyObject *>(o);
     *(proxyObject->proxy) = proxy;
     return o;
@@ -246,35 +240,34 @@ PyObject *makeProxyObject(const Pothos::Proxy &proxy)
 bool isProxyObject(PyObject *obj)
 {
     if (obj == nullptr) return false;
-    return Py_TYPE(obj) == &ProxyType;
+    return Py_TYPE(obj) == reinterpret_cast<PyTypeObject *>(getModuleState().proxyType.obj);
 }
 
-void registerProxyType(PyObject *m)
+static PyType_Slot ProxyType_slots[] = {
+    {Py_tp_new, (void *)PyType_GenericNew},
+    {Py_tp_dealloc, (void *)Proxy_dealloc},
+    {Py_tp_richcompare, (void *)Proxy_Compare},
+    {Py_tp_hash, (void *)Proxy_Hash},
+    {Py_tp_str, (void *)Proxy_toString},
+    {Py_tp_doc, (void *)"Pothos Proxy binding"},
+    {Py_tp_methods, (void *)Proxy_methods},
+    {Py_tp_init, (void *)Proxy_init},
+    {Py_tp_getattro, (void *)Proxy_getattr},
+    {Py_tp_setattro, (void *)Proxy_setattr},
+    {Py_tp_call, (void *)Proxy_callFunc},
+    {Py_nb_bool, (void *)Proxy_bool},
+    {0, nullptr}
+};
+
+static PyType_Spec ProxyType_spec = {
+    "Pothos.PothosModule.Proxy",
+    sizeof(ProxyObject),
+    0,
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    ProxyType_slots
+};
+
+int registerProxyType(PothosModuleState &state)
 {
-    ProxyType.tp_new = PyType_GenericNew;
-    ProxyType.tp_name = "PothosProxy";
-    ProxyType.tp_basicsize = sizeof(ProxyObject);
-    ProxyType.tp_dealloc = (destructor)Proxy_dealloc;
-    ProxyType.tp_richcompare = (richcmpfunc)Proxy_Compare;
-    ProxyType.tp_hash = (hashfunc)Proxy_Hash;
-    ProxyType.tp_str = (reprfunc)Proxy_toString;
-    ProxyType.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
-    ProxyType.tp_doc = "Pothos Proxy binding";
-    ProxyType.tp_methods = Proxy_methods;
-    ProxyType.tp_init = (initproc)Proxy_init;
-    ProxyType.tp_getattro = (getattrofunc)Proxy_getattr;
-    ProxyType.tp_setattro = (setattrofunc)Proxy_setattr;
-    ProxyType.tp_call = (ternaryfunc)Proxy_callFunc;
-
-    ProxyType.tp_as_number = &ProxyNumberMethods;
-    #if PY_MAJOR_VERSION >= 3
-    ProxyNumberMethods.nb_bool = (inquiry)Proxy_bool;
-    #else
-    ProxyNumberMethods.nb_nonzero = (inquiry)Proxy_bool;
-    #endif
-
-    if (PyType_Ready(&ProxyType) < 0) return;
-
-    Py_INCREF(&ProxyType);
-    PyModule_AddObject(m, "Proxy", (PyObject *)&ProxyType);
+    return makePothosType(&ProxyType_spec, state.proxyType);
 }
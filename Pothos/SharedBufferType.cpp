@@ -0,0 +1,232 @@
+// Copyright (c) 2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "PothosModule.hpp"
+#include <algorithm>
+#include <complex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+static void SharedBuffer_dealloc(SharedBufferObject *self)
+{
+    delete self->container;
+    freePothosObject((PyObject *)self);
+}
+
+static int SharedBuffer_getbuffer(SharedBufferObject *self, Py_buffer *view, int flags)
+{
+    if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE and self->readonly)
+    {
+        PyErr_SetString(PyExc_BufferError, "PothosSharedBuffer is read-only");
+        view->obj = nullptr;
+        return -1;
+    }
+
+    //the layout is fixed at construction, so the view can point into self
+    view->obj = (PyObject *)self;
+    Py_INCREF(self);
+    view->buf = self->address;
+    view->len = self->length;
+    view->readonly = self->readonly;
+    view->itemsize = self->itemsize;
+    view->format = ((flags & PyBUF_FORMAT) == PyBUF_FORMAT)? const_cast<char *>(self->format) : nullptr;
+    view->ndim = ((flags & PyBUF_ND) == PyBUF_ND)? self->ndim : 1;
+    view->shape = ((flags & PyBUF_ND) == PyBUF_ND)? self->shape : nullptr;
+    view->strides = ((flags & PyBUF_STRIDES) == PyBUF_STRIDES)? self->strides : nullptr;
+    view->suboffsets = nullptr;
+    view->internal = nullptr;
+    return 0;
+}
+
+/***********************************************************************
+ * Pothos::DType to buffer protocol format
+ **********************************************************************/
+static const char *dtypeToFormat(const Pothos::DType &dtype, Py_ssize_t &itemsize, bool &complexPair)
+{
+    complexPair = false;
+    const size_t elemSize = dtype.isComplex()? dtype.elemSize()/2 : dtype.elemSize();
+
+    if (dtype.isFloat())
+    {
+        itemsize = dtype.elemSize();
+        if (dtype.isComplex() and elemSize == 4) return "Zf";
+        if (dtype.isComplex() and elemSize == 8) return "Zd";
+        if (elemSize == 4) return "f";
+        if (elemSize == 8) return "d";
+    }
+
+    if (dtype.isInteger())
+    {
+        //no integer complex types in the buffer protocol, use an inner pair
+        complexPair = dtype.isComplex();
+        itemsize = elemSize;
+        switch (elemSize)
+        {
+        case 1: return dtype.isSigned()? "b" : "B";
+        case 2: return dtype.isSigned()? "h" : "H";
+        case 4: return dtype.isSigned()? "i" : "I";
+        //prefer long so numpy yields int64/uint64 rather than longlong scalars
+        case 8: if (sizeof(long) == 8) return dtype.isSigned()? "l" : "L";
+                return dtype.isSigned()? "q" : "Q";
+        default: break;
+        }
+    }
+
+    return nullptr;
+}
+
+PyObject *makeSharedBufferObject(const Pothos::Object &container, const size_t address, const size_t length, const Pothos::DType &dtype, const bool readonly)
+{
+    auto self = reinterpret_cast<SharedBufferObject *>(allocPothosObject(getModuleState().sharedBufferType));
+    if (self == nullptr) return nullptr;
+    self->container = new Pothos::Object(container);
+    self->address = reinterpret_cast<void *>(address);
+    self->readonly = readonly? 1 : 0;
+
+    //shape matches Pothos.Buffer.dtype_to_numpy: elements, [2], [dimension]
+    bool complexPair(false);
+    size_t dimension = dtype.dimension();
+    self->format = dtypeToFormat(dtype, self->itemsize, complexPair);
+    if (self->format == nullptr) //custom and unknown types are raw bytes
+    {
+        self->format = "B";
+        self->itemsize = 1;
+        dimension = 1;
+    }
+    const size_t elemBytes = size_t(self->itemsize)*(complexPair? 2 : 1)*std::max<size_t>(dimension, 1);
+    const size_t elements = length/elemBytes;
+    self->length = Py_ssize_t(elements*elemBytes);
+
+    self->ndim = 0;
+    self->shape[self->ndim++] = Py_ssize_t(elements);
+    if (complexPair) self->shape[self->ndim++] = 2;
+    if (dimension > 1) self->shape[self->ndim++] = Py_ssize_t(dimension);
+
+    //contiguous strides computed from the innermost dimension out
+    Py_ssize_t stride = self->itemsize;
+    for (int i = self->ndim-1; i >= 0; i--)
+    {
+        self->strides[i] = stride;
+        stride *= self->shape[i];
+    }
+
+    return (PyObject *)self;
+}
+
+/***********************************************************************
+ * numpy array views of shared buffers
+ **********************************************************************/
+static PyObjectRef getAsArray(PothosModuleState &state)
+{
+    {
+        std::lock_guard<PyStateMutex> lock(state.asarrayMutex);
+        if (state.asarray.obj != nullptr) return state.asarray;
+    }
+
+    //import outside of the lock, a racing thread may have stored it first
+    PyObjectRef asarray;
+    PyObjectRef numpy(PyImport_ImportModule("numpy"), REF_NEW);
+
+    //numpy does not import into isolated sub-interpreters, view the memory instead
+    if (numpy.obj == nullptr and not state.mainInterpreter and PyErr_ExceptionMatches(PyExc_ImportError))
+    {
+        PyErr_Clear();
+        asarray = PyObjectRef((PyObject *)&PyMemoryView_Type, REF_BORROWED);
+    }
+    else
+    {
+        if (numpy.obj == nullptr) throw Pothos::Exception("import numpy", getErrorString());
+        asarray = PyObjectRef(PyObject_GetAttrString(numpy.obj, "asarray"), REF_NEW);
+        if (asarray.obj == nullptr) throw Pothos::Exception("numpy.asarray", getErrorString());
+    }
+
+    std::lock_guard<PyStateMutex> lock(state.asarrayMutex);
+    if (state.asarray.obj == nullptr) state.asarray = asarray;
+    return state.asarray;
+}
+
+static PyObject *makeNumpyArrayObject(PyObject *buffer)
+{
+    const auto asarray = getAsArray(getModuleState());
+    PyObjectRef array(PyObject_CallFunctionObjArgs(asarray.obj, buffer, nullptr), REF_NEW);
+    if (array.obj == nullptr) throw Pothos::Exception("numpy.asarray(PothosSharedBuffer)", getErrorString());
+    return array.newRef();
+}
+
+PyObject *makeBufferChunkArrayObject(const Pothos::BufferChunk &buffer)
+{
+    //the shared buffer reference keeps the chunk memory alive with the array
+    const Pothos::Object container(buffer.getBuffer());
+    PyObjectRef view(makeSharedBufferObject(container, buffer.address, buffer.length, buffer.dtype, false), REF_NEW);
+    if (view.obj == nullptr) throw Pothos::Exception("makeBufferChunkArrayObject()", getErrorString());
+    return makeNumpyArrayObject(view.obj);
+}
+
+template <typename T>
+static Pothos::DType vectorElemDType(const T *)
+{
+    const std::string bits = std::to_string(8*sizeof(T));
+    if (std::is_floating_point<T>::value) return Pothos::DType("float"+bits);
+    if (std::is_signed<T>::value) return Pothos::DType("int"+bits);
+    return Pothos::DType("uint"+bits);
+}
+
+template <typename T>
+static Pothos::DType vectorElemDType(const std::complex<T> *)
+{
+    return Pothos::DType("complex_"+vectorElemDType(static_cast<const T *>(nullptr)).name());
+}
+
+template <typename T>
+static PyObject *makeVectorArrayObject(const Pothos::Object &obj)
+{
+    const auto &vec = obj.extract<std::vector<T>>();
+    const auto dtype = vectorElemDType(static_cast<const T *>(nullptr));
+    PyObjectRef buffer(makeSharedBufferObject(obj, size_t(vec.data()), vec.size()*sizeof(T), dtype, true), REF_NEW);
+    if (buffer.obj == nullptr) throw Pothos::Exception("makeVectorArrayObject()", getErrorString());
+    return makeNumpyArrayObject(buffer.obj);
+}
+
+PyObject *makeVectorArrayObject(const Pothos::Object &obj)
+{
+    const auto &type = obj.type();
+    #define ifTypeMakeVectorArray(T) \
+        if (type == typeid(std::vector<T>)) return makeVectorArrayObject<T>(obj);
+    ifTypeMakeVectorArray(signed short)
+    ifTypeMakeVectorArray(unsigned short)
+    ifTypeMakeVectorArray(signed int)
+    ifTypeMakeVectorArray(unsigned int)
+    ifTypeMakeVectorArray(signed long)
+    ifTypeMakeVectorArray(unsigned long)
+    ifTypeMakeVectorArray(signed long long)
+    ifTypeMakeVectorArray(unsigned long long)
+    ifTypeMakeVectorArray(float)
+    ifTypeMakeVectorArray(double)
+    ifTypeMakeVectorArray(std::complex<float>)
+    ifTypeMakeVectorArray(std::complex<double>)
+    return nullptr;
+}
+
+static PyType_Slot SharedBufferType_slots[] = {
+    {Py_tp_dealloc, (void *)SharedBuffer_dealloc},
+    {Py_tp_doc, (void *)"Pothos memory exported through the buffer protocol"},
+    {Py_bf_getbuffer, (void *)SharedBuffer_getbuffer},
+    {0, nullptr}
+};
+
+static PyType_Spec SharedBufferType_spec = {
+    "Pothos.PothosModule.SharedBuffer",
+    sizeof(SharedBufferObject),
+    0,
+    #ifdef Py_TPFLAGS_DISALLOW_INSTANTIATION
+    Py_TPFLAGS_DISALLOW_INSTANTIATION |
+    #endif
+    Py_TPFLAGS_DEFAULT,
+    SharedBufferType_slots
+};
+
+int registerSharedBufferType(PothosModuleState &state)
+{
+    return makePothosType(&SharedBufferType_spec, state.sharedBufferType);
+}
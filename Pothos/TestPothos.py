@@ -79,6 +79,11 @@ class TestPothosModule(unittest.TestCase):
         self.assertEqual(npArr0.dtype, npArr1.dtype)
         np.testing.assert_array_equal(npArr0, npArr1)
 
+        #the converted array is a writable view of the same memory
+        self.assertTrue(npArr1.flags.writeable)
+        npArr1[0] = 42
+        self.assertEqual(npArr0[0], 42)
+
     def test_complex_float_buffer(self):
         npArr0 = np.array([1, 2-1j, 3j], np.complex64)
         localBuffer0 = self.env.convertObjectToProxy(npArr0)
@@ -92,6 +97,135 @@ class TestPothosModule(unittest.TestCase):
         self.assertEqual(npArr0.dtype, npArr1.dtype)
         np.testing.assert_array_equal(npArr0, npArr1)
 
+    def test_readonly_buffer(self):
+        npArr0 = np.arange(10, dtype=np.float64)
+        npArr0.flags.writeable = False
+        localBuffer0 = self.env.convertObjectToProxy(npArr0)
+        print('localBuffer0 = %s'%localBuffer0)
+
+        self.assertEqual(localBuffer0.dtype.size(), 8)
+        self.assertEqual(localBuffer0.address, npArr0.__array_interface__['data'][0])
+
+        npArr1 = self.env.convertProxyToObject(localBuffer0)
+        np.testing.assert_array_equal(npArr0, npArr1)
+
+    def test_dtype_to_numpy(self):
+        DType = self.env.findProxy("Pothos/DType")
+        self.assertEqual(Pothos.dtypeToNumpy(DType("float32")), np.dtype(np.float32))
+        self.assertEqual(Pothos.dtypeToNumpy(DType("complex_float64")), np.dtype(np.complex128))
+        self.assertEqual(Pothos.dtypeToNumpy(DType("complex_int16", 3)), np.dtype((np.int16, (2, 3))))
+
+        #the same numpy dtype object is returned from the cache
+        self.assertIs(Pothos.dtypeToNumpy(DType("float32")), Pothos.dtypeToNumpy(DType("float32")))
+
+        #dtype names are accepted directly
+        self.assertEqual(Pothos.dtypeToNumpy("int16"), np.dtype(np.int16))
+        self.assertIs(Pothos.dtypeToNumpy("float32"), Pothos.dtypeToNumpy(DType("float32")))
+
+    def test_zero_copy_vectors(self):
+        vectors = self.env.findProxy("Pothos/Python/TestVectors")()
+        self.assertEqual(vectors.floats(3), [0.0, 1.0, 2.0])
+
+        Pothos.setZeroCopyVectors(True)
+        try:
+            ints = vectors.ints(10)
+            floats = vectors.floats(1000)
+            complexFloats = vectors.complexFloats(10)
+        finally: Pothos.setZeroCopyVectors(False)
+
+        self.assertEqual(ints.dtype, np.int32)
+        np.testing.assert_array_equal(ints, np.arange(10, dtype=np.int32))
+
+        self.assertEqual(floats.dtype, np.float32)
+        self.assertFalse(floats.flags.writeable)
+        np.testing.assert_array_equal(floats, np.arange(1000, dtype=np.float32))
+
+        self.assertEqual(complexFloats.dtype, np.complex64)
+        np.testing.assert_array_equal(complexFloats, np.arange(10, dtype=np.complex64))
+
+    def test_native_ports(self):
+        block = Pothos.Block()
+        block.setupInput("0", "int32")
+        block.setupOutput("0", "float32")
+
+        #port wrappers are native and cached per name
+        in0 = block.input("0")
+        self.assertIsInstance(in0, Pothos.InputPort)
+        self.assertIs(in0, block.input("0"))
+        self.assertIsInstance(block.output("0"), Pothos.OutputPort)
+
+        self.assertEqual(in0.dtype(), np.dtype(np.int32))
+        self.assertEqual(block.output("0").dtype(), np.dtype(np.float32))
+        self.assertEqual(in0.elements(), 0)
+        self.assertFalse(in0.hasMessage())
+        self.assertEqual(in0.labels(), ())
+        self.assertRaises(TypeError, in0.consume)
+
+        #batched calls accept any iterable
+        self.assertEqual(in0.popMessages(10), [])
+        in0.removeLabels([])
+        block.output("0").postLabels(())
+        block.output("0").postMessages(iter([1, "hello"]))
+        self.assertRaises(TypeError, block.output("0").postMessages, 42)
+
+        #other methods fall back to the port proxy
+        self.assertEqual(in0.totalElements(), 0)
+        self.assertEqual(in0.name(), "0")
+
+    def test_native_label(self):
+        label = Pothos.NativeLabel("lbl", 42, 5, width=2)
+        self.assertEqual((label.id, label.data, label.index, label.width), ("lbl", 42, 5, 2))
+        self.assertEqual(Pothos.NativeLabel().id, "")
+
+        #compares equal to native labels and Pothos.Label proxies
+        self.assertEqual(label, Pothos.NativeLabel("lbl", 42, 5, 2))
+        self.assertNotEqual(label, Pothos.NativeLabel("lbl", 42, 6, 2))
+        self.assertEqual(label, Pothos.Label("lbl", 42, 5, 2))
+        self.assertNotEqual(label, 42)
+
+        #other attributes fall back to the managed label
+        self.assertEqual(label.call("get:index"), 5)
+
+    def test_lazy_attrs(self):
+        self.assertTrue(Pothos.Label)
+        self.assertIs(Pothos.Packet, Pothos.Packet)
+        self.assertRaises(AttributeError, getattr, Pothos, "NoSuchAttribute")
+
+        #star imports and dir() include the lazy attributes
+        for name in ("Label", "LabelIteratorRange", "Packet"):
+            self.assertIn(name, Pothos.__all__)
+            self.assertIn(name, dir(Pothos))
+        namespace = dict()
+        exec("from Pothos import *", namespace)
+        self.assertIs(namespace["Packet"], Pothos.Packet)
+        self.assertNotIn("sys", namespace)
+
+    def test_async_logger(self):
+        logger = Pothos.AsyncLogger("TestPothos", 10)
+        self.assertGreater(logger.level, 0)
+        self.assertEqual(logger.dropped, 0)
+
+        #records over the limit of 10 per second are dropped, at most
+        #two windows are seen when the loop crosses a second boundary
+        for i in range(100): logger.log("TestPothos", "record %d"%i, 10)
+        logger.flush()
+        self.assertGreaterEqual(logger.dropped, 80)
+        self.assertLessEqual(logger.dropped, 90)
+
+        #an uninitialized logger raises instead of crashing
+        uninit = Pothos.AsyncLogger.__new__(Pothos.AsyncLogger)
+        self.assertRaises(RuntimeError, getattr, uninit, "level")
+        self.assertRaises(RuntimeError, uninit.log, "TestPothos", "text", 20)
+
+    def test_block_logger(self):
+        #block loggers follow the level of the bound "Pothos" logger
+        logger = Pothos.Block().getLogger()
+        self.assertEqual(logger.name, "Pothos.Block")
+        self.assertEqual(logger.getEffectiveLevel(), Pothos.getLogLevel("Pothos"))
+
+        #the unscanned generation never runs ahead of a scan
+        self.assertLessEqual(Pothos.getLogLevelGeneration(False), Pothos.getLogLevelGeneration())
+
     def test_packet_type(self):
         pkt0 = Pothos.Packet()
         pkt0.payload = np.array([1, 2, 3], np.int32)
@@ -4,19 +4,53 @@
 
 from . PothosModule import *
 from . Block import Block
-from . Label import Label, LabelIteratorRange
 from . InputPort import InputPort
 from . OutputPort import OutputPort
 from . Topology import Topology
 from . BlockRegistry import BlockRegistry
-from . Logger import LogHandler
-from . Packet import Packet
+from . Logger import LogHandler, bindLogger, syncLogLevels
 
+import importlib
 import logging
+import sys
+import types
+
+# These attributes look up managed classes when their module is imported,
+# so they are resolved on first use rather than when Pothos is imported.
+_LAZY_ATTRS = {
+    'Label': ('Label', 'Label'),
+    'LabelIteratorRange': ('Label', 'LabelIteratorRange'),
+    'Packet': ('Packet', 'Packet'),
+}
+
+def _resolveLazyAttr(name):
+    module, attr = _LAZY_ATTRS[name]
+    value = getattr(importlib.import_module('.' + module, __name__), attr)
+    globals()[name] = value
+    return value
+
+if sys.version_info >= (3, 7):
+    def __getattr__(name):
+        if name not in _LAZY_ATTRS:
+            raise AttributeError("module %r has no attribute %r" % (__name__, name))
+        return _resolveLazyAttr(name)
+
+    def __dir__():
+        return sorted(set(globals()) | set(_LAZY_ATTRS))
+else:
+    for _name in _LAZY_ATTRS: _resolveLazyAttr(_name)
+
+# the public names, "from Pothos import *" resolves the lazy attributes
+__all__ = sorted(set(_name for _name, _value in globals().items()
+    if not _name.startswith('_') and not isinstance(_value, types.ModuleType)) | set(_LAZY_ATTRS))
 
 # logging.captureWarnings() redirects all outputs from the "warnings" module
 # to a Python logger named "py.warnings". Adding our log handler to this logger
 # results in all Python warnings being consumed by our infrastructure.
+# The handler starts its async logger on first use.
 logging.basicConfig(level=logging.INFO)
-logging.getLogger("py.warnings").addHandler(LogHandler("py.warnings"))
+bindLogger(logging.getLogger("py.warnings"))
 logging.captureWarnings(True)
+
+# Block loggers are children of "Pothos" and forward through its handler.
+bindLogger(logging.getLogger("Pothos"))
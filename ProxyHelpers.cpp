@@ -20,10 +20,28 @@ static PyObject *convertProxyToPyObject(const Pothos::Proxy &proxy)
     return std::dynamic_pointer_cast<PythonProxyHandle>(proxy.getHandle())->ref.newRef();
 }
 
+/***********************************************************************
+ * Is the module attribute still the cached object? Used by block factories
+ * to notice a reloaded module with one lock and no proxy calls.
+ **********************************************************************/
+static bool isModuleAttributeCurrent(const Pothos::Proxy &cached, const std::string &moduleName, const std::string &attrName)
+{
+    auto handle = std::dynamic_pointer_cast<PythonProxyHandle>(cached.getHandle());
+    if (not handle or not handle->env->interpreterAlive()) return false;
+    PyInterpLock lock(handle->env.get());
+    PyObject *module = PyDict_GetItemString(PyImport_GetModuleDict(), moduleName.c_str());
+    if (module == nullptr) return false;
+    PyObjectRef attr(PyObject_GetAttrString(module, attrName.c_str()), REF_NEW);
+    if (attr.obj == nullptr) PyErr_Clear();
+    return attr.obj == handle->obj;
+}
+
 pothos_static_block(pothosRegisterPyObjectHelpers)
 {
     Pothos::PluginRegistry::add("/proxy_helpers/python/pyobject_to_proxy",
         PyObjectToProxyFcn(&convertPyObjectToProxy));
     Pothos::PluginRegistry::add("/proxy_helpers/python/proxy_to_pyobject",
         ProxyToPyObjectFcn(&convertProxyToPyObject));
+    Pothos::PluginRegistry::add("/proxy_helpers/python/is_module_attribute_current",
+        Pothos::Callable(&isModuleAttributeCurrent));
 }
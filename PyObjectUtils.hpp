@@ -4,14 +4,39 @@
 #pragma once
 #include <Python.h>
 #include <Pothos/Proxy.hpp>
+#include <Pothos/Framework/BufferChunk.hpp>
+#include <atomic>
 #include <functional>
 #include <iostream>
+#include <cassert>
+#include <string>
+#ifdef Py_GIL_DISABLED
+#include <mutex>
+#endif
 
 /***********************************************************************
  * Conversion function pointer types
  **********************************************************************/
 typedef std::function<Pothos::Proxy(Pothos::ProxyEnvironment::Sptr, PyObject*)> PyObjectToProxyFcn;
 typedef std::function<PyObject *(const Pothos::Proxy &)> ProxyToPyObjectFcn;
+typedef std::function<PyObject *(const Pothos::BufferChunk &)> BufferChunkToPyObjectFcn;
+
+//! counts Poco level changes of the loggers bound to python loggers
+typedef const std::atomic<long long> *LogLevelGenerationPtr;
+
+/***********************************************************************
+ * Mutex for caches that are otherwise protected by the GIL:
+ * only free-threaded builds need to lock, elsewhere it does nothing.
+ **********************************************************************/
+#ifdef Py_GIL_DISABLED
+typedef std::mutex PyStateMutex;
+#else
+struct PyStateMutex
+{
+    void lock(void){}
+    void unlock(void){}
+};
+#endif
 
 /***********************************************************************
  * simple holder of a object ref
@@ -64,6 +89,9 @@ struct PyObjectRef
 /***********************************************************************
  * C++ locking structures for calling into and out of the interpreter
  **********************************************************************/
+//! In free-threaded builds the GIL state and thread state locks
+//! only attach and detach the thread state, so they remain cheap.
+//! Detaching around blocking calls is still required by the GC.
 struct PyGilStateLock
 {
     PyGILState_STATE _s;
@@ -77,3 +105,42 @@ struct PyThreadStateLock
     PyThreadStateLock(void):_s(PyEval_SaveThread()){}
     ~PyThreadStateLock(void){PyEval_RestoreThread(_s);}
 };
+
+/***********************************************************************
+ * string conversion and error reporting helpers
+ **********************************************************************/
+inline std::string PyObjToStdString(PyObject *o)
+{
+    #if PY_MAJOR_VERSION >= 3
+    assert(PyUnicode_Check(o));
+    Py_ssize_t size = 0;
+    const char *c = PyUnicode_AsUTF8AndSize(o, &size);
+    return std::string(c, size);
+    #else
+    assert(PyString_Check(o));
+    return std::string(PyString_AsString(o), PyString_Size(o));
+    #endif
+}
+
+inline PyObject *StdStringToPyObject(const std::string &s)
+{
+    #if PY_MAJOR_VERSION >= 3
+    return PyUnicode_DecodeLocaleAndSize(s.c_str(), s.size(), nullptr);
+    #else
+    return PyString_FromStringAndSize(s.c_str(), s.size());
+    #endif
+}
+
+inline std::string getErrorString(void)
+{
+    if (not PyErr_Occurred()) return "";
+    PyObject *type = nullptr, *value = nullptr, *traceback = nullptr;
+    PyErr_Fetch(&type, &value, &traceback);
+    assert(value != nullptr);
+    std::string errorMsg = PyObjToStdString(PyObjectRef(PyObject_Str(value), REF_NEW).obj);
+    Py_XDECREF(type);
+    Py_XDECREF(value);
+    Py_XDECREF(traceback);
+    PyErr_Clear();
+    return errorMsg;
+}
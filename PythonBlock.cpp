@@ -1,18 +1,65 @@
 // Copyright (c) 2014-2021 Josh Blum
 // SPDX-License-Identifier: BSL-1.0
 
+#include "PythonProxy.hpp"
 #include <Pothos/Framework.hpp>
 #include <Pothos/Managed.hpp>
 #include <Pothos/Proxy.hpp>
+#include <Pothos/Plugin.hpp>
 
+/***********************************************************************
+ * python method resolution helpers
+ **********************************************************************/
+static PyObjectRef getWeakReferent(PyObject *weak)
+{
+    #if PY_VERSION_HEX >= 0x030D0000
+    PyObject *obj = nullptr;
+    if (PyWeakref_GetRef(weak, &obj) < 0) PyErr_Clear();
+    return PyObjectRef(obj, REF_NEW);
+    #else
+    PyObject *obj = PyWeakref_GetObject(weak);
+    return PyObjectRef((obj == Py_None)? nullptr : obj, REF_BORROWED);
+    #endif
+}
+
+//! get the method from the class, or null when its the Pothos.Block default
+static PyObjectRef getOverride(PyObject *cls, PyObject *baseCls, const char *name, const char *fcnName)
+{
+    PyObjectRef method(PyObject_GetAttrString(cls, name), REF_NEW);
+    PyObjectRef baseMethod(PyObject_GetAttrString(baseCls, name), REF_NEW);
+    const bool isDefault = (method.obj != nullptr and baseMethod.obj != nullptr and
+        PyObject_RichCompareBool(method.obj, baseMethod.obj, Py_EQ) == 1);
+    PyErr_Clear();
+    if (isDefault) return PyObjectRef();
+    return PyObjectRef(PyObject_GetAttrString(cls, fcnName), REF_NEW);
+}
+
+/***********************************************************************
+ * python block wrapper
+ **********************************************************************/
 class PythonBlock : Pothos::Block
 {
 public:
-    PythonBlock(void)
+    PythonBlock(void):
+        _self(nullptr),
+        _resolved(false),
+        _logLevelGeneration(nullptr),
+        _syncedGeneration(-1)
     {
         this->registerCall(this, POTHOS_FCN_TUPLE(PythonBlock, _setPyBlock));
     }
 
+    ~PythonBlock(void)
+    {
+        if (not _resolved) return;
+        PyInterpLock lock(_env.get());
+        _work = PyObjectRef();
+        _activate = PyObjectRef();
+        _deactivate = PyObjectRef();
+        _propagateLabels = PyObjectRef();
+        _syncLogLevels = PyObjectRef();
+    }
+
     static Block *make(void)
     {
         return new PythonBlock();
@@ -21,27 +68,68 @@ public:
     void _setPyBlock(const Pothos::Proxy &block)
     {
         _block = block;
+
+        //resolve the lifecycle methods once from the python class,
+        //the block is a weak proxy so only unbound functions are stored
+        auto handle = std::dynamic_pointer_cast<PythonProxyHandle>(block.getHandle());
+        if (not handle) return;
+        _env = handle->env;
+        PyInterpLock lock(_env.get());
+        auto self = getWeakReferent(handle->obj);
+        PyObjectRef module(PyImport_ImportModule("Pothos"), REF_NEW);
+        PyObjectRef baseCls((module.obj == nullptr)? nullptr : PyObject_GetAttrString(module.obj, "Block"), REF_NEW);
+        if (self.obj == nullptr or baseCls.obj == nullptr)
+        {
+            PyErr_Clear();
+            return;
+        }
+
+        auto cls = (PyObject *)Py_TYPE(self.obj);
+        _work = getOverride(cls, baseCls.obj, "work", "work");
+        _activate = getOverride(cls, baseCls.obj, "activate", "activate");
+        _deactivate = getOverride(cls, baseCls.obj, "deactivate", "deactivate");
+        _propagateLabels = getOverride(cls, baseCls.obj, "propagateLabels", "_propagateLabels");
+        _syncLogLevels = PyObjectRef(PyObject_GetAttrString(module.obj, "syncLogLevels"), REF_NEW);
+        PyErr_Clear();
+        if (Pothos::PluginRegistry::exists("/proxy_helpers/python/log_level_generation"))
+        {
+            _logLevelGeneration = Pothos::PluginRegistry::get("/proxy_helpers/python/log_level_generation").getObject().extract<LogLevelGenerationPtr>();
+        }
+        _self = handle->obj;
+        _resolved = true;
     }
 
     void work(void)
     {
-        _block.call("work");
+        this->syncLogLevels();
+        if (not _resolved) _block.call("work");
+        else if (_work.obj != nullptr) this->callMethod(_work);
     }
 
     void activate(void)
     {
-        _block.call("activate");
+        this->syncLogLevels();
+        if (not _resolved) _block.call("activate");
+        else if (_activate.obj != nullptr) this->callMethod(_activate);
     }
 
     void deactivate(void)
     {
-        _block.call("deactivate");
+        if (not _resolved) _block.call("deactivate");
+        else if (_deactivate.obj != nullptr) this->callMethod(_deactivate);
     }
 
     void propagateLabels(const Pothos::InputPort *input)
     {
         //forward to wrapper that takes input port name
-        auto not_implemeneted = _block.call<bool>("_propagateLabels", input->name());
+        bool not_implemeneted = true;
+        if (not _resolved) not_implemeneted = _block.call<bool>("_propagateLabels", input->name());
+        else if (_propagateLabels.obj != nullptr)
+        {
+            PyInterpLock lock(_env.get());
+            PyObjectRef name(StdStringToPyObject(input->name()), REF_NEW);
+            not_implemeneted = this->callMethod(_propagateLabels, name.obj);
+        }
 
         //if the overload was not implemented, call base function
         if (not_implemeneted) Pothos::Block::propagateLabels(input);
@@ -61,7 +149,49 @@ public:
         return env->convertProxyToObject(result);
     }
 
+private:
+    //apply Poco level changes to the python loggers, even for blocks that never log
+    void syncLogLevels(void)
+    {
+        if (_logLevelGeneration == nullptr or _syncLogLevels.obj == nullptr) return;
+        const long long generation = *_logLevelGeneration;
+        if (generation == _syncedGeneration) return;
+        _syncedGeneration = generation;
+        PyInterpLock lock(_env.get());
+        PyObjectRef result(PyObject_CallObject(_syncLogLevels.obj, nullptr), REF_NEW);
+        if (result.obj == nullptr) PyErr_Clear();
+    }
+
+    //call the unbound method on the python block, return the result truth
+    bool callMethod(const PyObjectRef &fcn, PyObject *arg = nullptr)
+    {
+        PyInterpLock lock(_env.get());
+        auto self = getWeakReferent(_self);
+        if (self.obj == nullptr) throw Pothos::ProxyHandleCallError(
+            "PythonBlock::callMethod()", "python block no longer exists");
+        PyObjectRef result(PyObject_CallFunctionObjArgs(fcn.obj, self.obj, arg, nullptr), REF_NEW);
+        auto errorMsg = getErrorString();
+        if (not errorMsg.empty())
+        {
+            throw Pothos::ProxyExceptionMessage(errorMsg);
+        }
+        return PyObject_IsTrue(result.obj) == 1;
+    }
+
+public:
     Pothos::Proxy _block;
+
+private:
+    std::shared_ptr<PythonProxyEnvironment> _env;
+    PyObject *_self; //weak proxy held by _block
+    bool _resolved;
+    PyObjectRef _work;
+    PyObjectRef _activate;
+    PyObjectRef _deactivate;
+    PyObjectRef _propagateLabels;
+    PyObjectRef _syncLogLevels;
+    LogLevelGenerationPtr _logLevelGeneration;
+    long long _syncedGeneration;
 };
 
 static Pothos::BlockRegistry registerPythonBlock(
@@ -3,6 +3,8 @@
 
 #include <Pothos/System/Version.hpp>
 #if POTHOS_API_VERSION >= 0x00050000
+#include "PythonConfLoader.hpp"
+#include "PythonStartup.hpp"
 #include <Pothos/Util/BlockDescription.hpp>
 #include <Pothos/Plugin.hpp>
 #include <Pothos/System.hpp>
@@ -10,13 +12,26 @@
 #include <Poco/Path.h>
 #include <Poco/File.h>
 #include <Poco/StringTokenizer.h>
+#include <Poco/TemporaryFile.h>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <sstream>
 #include <tuple>
 #include <map>
+#include <set>
+
+using json = nlohmann::json;
 
 /***********************************************************************
- * Recursive traverse for python files
+ * Recursive traverse for python files, recording directory mtimes
  **********************************************************************/
-static std::vector<Poco::Path> getPythonFiles(const Poco::Path &path)
+static std::vector<Poco::Path> getPythonFiles(const Poco::Path &path, json &dirs)
 {
     std::vector<Poco::Path> paths;
 
@@ -28,10 +43,11 @@ static std::vector<Poco::Path> getPythonFiles(const Poco::Path &path)
     }
     else if (file.isDirectory())
     {
+        dirs[path.toString()] = file.getLastModified().epochMicroseconds();
         std::vector<std::string> files; file.list(files);
         for (size_t i = 0; i < files.size(); i++)
         {
-            auto subpaths = getPythonFiles(Poco::Path(path, files[i]).absolute());
+            auto subpaths = getPythonFiles(Poco::Path(path, files[i]).absolute(), dirs);
             paths.insert(paths.end(), subpaths.begin(), subpaths.end());
         }
     }
@@ -40,37 +56,204 @@ static std::vector<Poco::Path> getPythonFiles(const Poco::Path &path)
 }
 
 /***********************************************************************
- * The loader factory opens a python environment,
- * locates the specified module and class (or function),
- * and invokes it with the specified arguments.
+ * Persistent cache of parsed block descriptions per conf file
  **********************************************************************/
-static Pothos::Object opaquePythonLoaderFactory(
-    const std::vector<Poco::Path> &modulePaths,
-    const std::string &moduleName,
-    const std::string &functionName,
-    const Pothos::Object *args,
-    const size_t numArgs)
+std::string getDocCacheVersion(void)
+{
+    //the parser output depends on the library build
+    return Pothos::System::getLibVersion() + "-" + Pothos::System::getAbiVersion();
+}
+
+std::string getDocCachePath(const std::string &confFilePath)
+{
+    std::ostringstream name;
+    name << std::hex << std::hash<std::string>()(confFilePath) << ".json";
+    Poco::Path path(Pothos::System::getUserDataPath());
+    path.makeDirectory().pushDirectory("PythonBlockDocs");
+    path.setFileName(name.str());
+    return path.toString();
+}
+
+json loadDocCache(const std::string &cachePath)
+{
+    try
+    {
+        std::ifstream ifs(cachePath.c_str());
+        if (ifs)
+        {
+            const auto cache = json::parse(ifs);
+            if (cache.is_object() and cache.value("version", std::string()) == getDocCacheVersion()) return cache;
+        }
+    }
+    catch (...) {} //missing or corrupt caches are rebuilt
+    return json::object();
+}
+
+void saveDocCache(const std::string &cachePath, const json &cache)
+{
+    try
+    {
+        //a unique name keeps concurrent loaders from writing the same file
+        const auto dirPath = Poco::Path(cachePath).parent().toString();
+        Poco::File(dirPath).createDirectories();
+        const auto tempPath = Poco::TemporaryFile::tempName(dirPath);
+        {
+            std::ofstream ofs(tempPath.c_str());
+            ofs << cache.dump();
+        }
+        Poco::File(tempPath).renameTo(cachePath);
+    }
+    catch (...) {} //the cache is optional, the loader works without it
+}
+
+json getFileStat(const std::string &path)
+{
+    const Poco::File file(path);
+    if (not file.exists()) return nullptr;
+    return json::array({file.getLastModified().epochMicroseconds(), file.getSize()});
+}
+
+bool dirsUnchanged(const json &dirs)
+{
+    if (not dirs.is_object() or dirs.empty()) return false;
+    for (const auto &entry : dirs.items())
+    {
+        const Poco::File dir(entry.key());
+        if (not dir.exists() or dir.getLastModified().epochMicroseconds() != entry.value().get<Poco::Timestamp::TimeVal>()) return false;
+    }
+    return true;
+}
+
+bool isDocCacheHit(const json &cachedFiles, const std::string &source, const json &stat)
+{
+    if (stat.is_null() or not cachedFiles.is_object()) return false;
+    const auto cachedIt = cachedFiles.find(source);
+    if (cachedIt == cachedFiles.end() or not cachedIt->is_object()) return false;
+    return cachedIt->value("stat", json()) == stat and cachedIt->value("docs", json()).is_object();
+}
+
+json parseDocs(const std::string &source)
+{
+    Pothos::Util::BlockDescriptionParser parser;
+    parser.feedFilePath(source);
+    json docs = json::object();
+    for (const auto &factory : parser.listFactories())
+    {
+        docs[factory] = parser.getJSONObject(factory);
+    }
+    return docs;
+}
+
+//! helper threads in use by all loaders, bounded by the hardware concurrency
+static std::atomic<size_t> parseHelperThreads(0);
+
+std::vector<json> parseDocsParallel(const std::vector<std::string> &sources, const size_t numThreads)
+{
+    std::vector<json> results(sources.size());
+    std::vector<std::exception_ptr> errors(sources.size());
+    std::atomic<size_t> next(0);
+    auto worker = [&](void)
+    {
+        for (size_t i = next++; i < sources.size(); i = next++)
+        {
+            try {results[i] = parseDocs(sources[i]);}
+            catch (...) {errors[i] = std::current_exception();}
+        }
+    };
+
+    //claim helpers from the shared bound, the caller is always a worker
+    const size_t maxHelpers = std::max(1u, std::thread::hardware_concurrency())-1;
+    std::vector<std::thread> threads;
+    while (threads.size()+1 < std::min(sources.size(), numThreads))
+    {
+        auto inUse = parseHelperThreads.load();
+        if (inUse >= maxHelpers) break;
+        if (not parseHelperThreads.compare_exchange_weak(inUse, inUse+1)) continue;
+        try {threads.emplace_back(worker);}
+        catch (...) {parseHelperThreads--; break;}
+    }
+    worker();
+    for (auto &thread : threads) thread.join();
+    parseHelperThreads -= threads.size();
+
+    for (const auto &error : errors) if (error) std::rethrow_exception(error);
+    return results;
+}
+
+/***********************************************************************
+ * A python block factory: the environment, module search paths,
+ * and the module's class (or function) are resolved on first use.
+ **********************************************************************/
+PythonFactory::PythonFactory(const std::vector<Poco::Path> &modulePaths, const std::string &moduleName,
+    const std::string &functionName, const Pothos::ProxyEnvironmentArgs &envArgs):
+    modulePaths(modulePaths),
+    moduleName(moduleName),
+    functionName(functionName),
+    envArgs(envArgs)
 {
-    //create python environment
-    auto env = Pothos::ProxyEnvironment::make("python");
+    return;
+}
 
-    //add to the system path
+Pothos::Proxy PythonFactory::resolve(void)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_callable and this->isCurrent()) return _callable;
+    PythonStartupTimer timer("factory resolve", moduleName+"."+functionName);
+    _callable = Pothos::Proxy();
+
+    //create python environment, in the interpreter group when specified
+    auto env = Pothos::ProxyEnvironment::make("python", envArgs);
+
+    //add to the system path when not found already
     auto sys = env->findProxy("sys");
     auto sysPath = sys.call("get:path");
     for (const auto &path : modulePaths)
     {
-        try
-        {
-            //throws if the path is not found already
-            sysPath.call("index", path.toString());
-        }
-        catch (...)
+        if (not sysPath.call<bool>("__contains__", path.toString()))
         {
-            //and so we add our path here
             sysPath.call("append", path.toString());
         }
     }
 
+    //locate the module and the factory within it
+    try
+    {
+        _callable = env->findProxy(moduleName).call("get:"+functionName);
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        throw Pothos::Exception("PythonFactory::resolve()", "factory "+moduleName+"."+functionName+" not found: "+ex.displayText());
+    }
+    _isCurrent = Pothos::PluginRegistry::get("/proxy_helpers/python/is_module_attribute_current").getObject().extract<Pothos::Callable>();
+    return _callable;
+}
+
+bool PythonFactory::isCurrent(void)
+{
+    //a reloaded or removed module, or an ended interpreter, needs a new lookup:
+    //the attribute is compared by identity under one interpreter lock
+    try
+    {
+        return _isCurrent.call<bool>(_callable, moduleName, functionName);
+    }
+    catch (const Pothos::Exception &)
+    {
+        return false;
+    }
+}
+
+/***********************************************************************
+ * The loader factory invokes the resolved python factory
+ * with the specified arguments converted into its environment.
+ **********************************************************************/
+static Pothos::Object opaquePythonLoaderFactory(
+    const std::shared_ptr<PythonFactory> &factory,
+    const Pothos::Object *args,
+    const size_t numArgs)
+{
+    auto callable = factory->resolve();
+    auto env = callable.getEnvironment();
+
     //convert arguments into proxy environment
     std::vector<Pothos::Proxy> proxyArgs(numArgs);
     for (size_t i = 0; i < numArgs; i++)
@@ -78,11 +261,8 @@ static Pothos::Object opaquePythonLoaderFactory(
         proxyArgs[i] = env->makeProxy(args[i]);
     }
 
-    //locate the module
-    auto mod = env->findProxy(moduleName);
-
     //call into the factory
-    auto block = mod.getHandle()->call(functionName, proxyArgs.data(), proxyArgs.size());
+    auto block = callable.getHandle()->call("()", proxyArgs.data(), proxyArgs.size());
     return Pothos::Object(block);
 }
 
@@ -93,6 +273,7 @@ static std::vector<Pothos::PluginPath> PythonLoader(const std::map<std::string,
 {
     std::vector<Pothos::PluginPath> entries;
     std::vector<std::tuple<Pothos::PluginPath, std::string, std::string>> factories;
+    std::set<std::string> factoryPaths;
     const auto tokOptions = Poco::StringTokenizer::TOK_IGNORE_EMPTY | Poco::StringTokenizer::TOK_TRIM;
     const std::string tokSep(" \t");
 
@@ -101,6 +282,11 @@ static std::vector<Pothos::PluginPath> PythonLoader(const std::map<std::string,
     if (confFilePathIt == config.end() or confFilePathIt->second.empty())
         throw Pothos::Exception("missing confFilePath");
     const auto rootDir = Poco::Path(confFilePathIt->second).makeParent();
+    PythonStartupTimer scanTimer("conf loader scan", confFilePathIt->second);
+    const auto docCachePath = getDocCachePath(confFilePathIt->second);
+    const auto docCache = loadDocCache(docCachePath);
+    const auto cachedFiles = docCache.value("files", json::object());
+    json newDocCache = {{"version", getDocCacheVersion()}, {"files", json::object()}};
 
     //doc sources: scan sources unless doc sources are specified
     std::vector<std::string> docSources;
@@ -112,10 +298,22 @@ static std::vector<Pothos::PluginPath> PythonLoader(const std::map<std::string,
         docSources.push_back(absPath.toString());
     }
 
+    //otherwise use the cached file list when no directory changed
+    else if (docCache.count("dirs") != 0 and dirsUnchanged(docCache["dirs"]))
+    {
+        for (const auto &entry : cachedFiles.items()) docSources.push_back(entry.key());
+        newDocCache["dirs"] = docCache["dirs"];
+    }
+
     //otherwise scan all .py files in this directory
-    else for (const auto &path : getPythonFiles(rootDir))
+    else
     {
-        docSources.push_back(path.toString());
+        json dirs = json::object();
+        for (const auto &path : getPythonFiles(rootDir, dirs))
+        {
+            docSources.push_back(path.toString());
+        }
+        newDocCache["dirs"] = dirs;
     }
 
     //load the factories: use this when providing no block description
@@ -131,24 +329,46 @@ static std::vector<Pothos::PluginPath> PythonLoader(const std::map<std::string,
             throw Pothos::Exception("factory entry not in format /block/path:Module.Function");
         }
         const auto path = Pothos::PluginPath("/blocks", factoryMarkup.substr(0, colonPos));
+        if (not factoryPaths.insert(path.toString()).second) continue; //the first entry for a path is used
         const auto module = factoryMarkup.substr(colonPos+1, (lastDotPos-colonPos)-1);
         const auto function = factoryMarkup.substr(lastDotPos+1);
         factories.emplace_back(path, module, function);
     }
 
-    //generate JSON block descriptions
-    Pothos::Util::BlockDescriptionParser parser;
-    for (const auto &source : docSources) parser.feedFilePath(source);
+    scanTimer.stop();
+
+    //generate JSON block descriptions, only parsing changed sources
+    PythonStartupTimer docsTimer("conf loader docs", confFilePathIt->second);
+    std::vector<std::string> parseSources;
+    for (const auto &source : docSources)
+    {
+        const auto stat = getFileStat(source);
+        const bool cached = isDocCacheHit(cachedFiles, source, stat);
+        newDocCache["files"][source] = {{"stat", stat}, {"docs", cached? cachedFiles.at(source).at("docs") : json()}};
+        if (not cached) parseSources.push_back(source);
+    }
+    const auto parsedDocs = parseDocsParallel(parseSources, std::max(1u, std::thread::hardware_concurrency()));
+    for (size_t i = 0; i < parseSources.size(); i++)
+    {
+        newDocCache["files"][parseSources[i]]["docs"] = parsedDocs[i];
+    }
+    if (newDocCache != docCache) saveDocCache(docCachePath, newDocCache);
 
     //store block paths in handle, and store doc paths
-    for (const auto &factory : parser.listFactories())
+    for (const auto &file : newDocCache["files"])
     {
-        const auto pluginPath = Pothos::PluginPath("/blocks/docs", factory);
-        Pothos::PluginRegistry::add(pluginPath, parser.getJSONObject(factory));
-        entries.push_back(pluginPath);
+        for (const auto &doc : file["docs"].items())
+        {
+            const auto pluginPath = Pothos::PluginPath("/blocks/docs", doc.key());
+            Pothos::PluginRegistry::add(pluginPath, doc.value().get<std::string>());
+            entries.push_back(pluginPath);
+        }
     }
 
+    docsTimer.stop();
+
     //additional module search paths
+    PythonStartupTimer factoriesTimer("conf loader factories", confFilePathIt->second);
     std::vector<Poco::Path> modulePaths(1, rootDir);
     const auto pathIt = config.find("path");
     if (pathIt != config.end()) for (const auto &path :
@@ -157,14 +377,22 @@ static std::vector<Pothos::PluginPath> PythonLoader(const std::map<std::string,
         modulePaths.push_back(Poco::Path(path).makeAbsolute(rootDir));
     }
 
+    //optional sub-interpreter group shared by the blocks
+    Pothos::ProxyEnvironmentArgs envArgs;
+    const auto interpreterIt = config.find("interpreter");
+    if (interpreterIt != config.end() and not interpreterIt->second.empty())
+    {
+        envArgs["interpreter"] = interpreterIt->second;
+    }
+
     //register for all factory paths
     for (const auto &factoryTuple : factories)
     {
         const auto &pluginPath = std::get<0>(factoryTuple);
+        const std::shared_ptr<PythonFactory> pythonFactory(new PythonFactory(
+            modulePaths, std::get<1>(factoryTuple), std::get<2>(factoryTuple), envArgs));
         const auto factory = Pothos::Callable(&opaquePythonLoaderFactory)
-            .bind(modulePaths, 0)
-            .bind(std::get<1>(factoryTuple), 1)
-            .bind(std::get<2>(factoryTuple), 2);
+            .bind(pythonFactory, 0);
         Pothos::PluginRegistry::addCall(pluginPath, factory);
         entries.push_back(pluginPath);
     }
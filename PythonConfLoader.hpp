@@ -0,0 +1,71 @@
+// Copyright (c) 2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <Pothos/Proxy.hpp>
+#include <Pothos/Callable.hpp>
+#include <Poco/Path.h>
+#include <json.hpp>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/***********************************************************************
+ * Persistent cache of parsed block descriptions per conf file:
+ * entries are keyed by source path and revalidated by mtime and size,
+ * directory mtimes tell if the scanned file list is still current.
+ **********************************************************************/
+
+//! the version key of caches written by this build of the Pothos library
+std::string getDocCacheVersion(void);
+
+//! get the cache file path for a conf file in the user data directory
+std::string getDocCachePath(const std::string &confFilePath);
+
+//! load a cache, empty when missing, corrupt, or from another version
+nlohmann::json loadDocCache(const std::string &cachePath);
+
+//! save a cache through a uniquely named temporary file
+void saveDocCache(const std::string &cachePath, const nlohmann::json &cache);
+
+//! get the [mtime, size] of a file, or null when it does not exist
+nlohmann::json getFileStat(const std::string &path);
+
+//! are the recorded directory mtimes still current?
+bool dirsUnchanged(const nlohmann::json &dirs);
+
+//! are the cached docs of the source still valid for its current stat?
+bool isDocCacheHit(const nlohmann::json &cachedFiles, const std::string &source, const nlohmann::json &stat);
+
+//! parse the block descriptions of a source file by factory path
+nlohmann::json parseDocs(const std::string &source);
+
+//! parse each source on up to numThreads threads, including the caller
+std::vector<nlohmann::json> parseDocsParallel(const std::vector<std::string> &sources, size_t numThreads);
+
+/***********************************************************************
+ * A python block factory from the conf loader
+ **********************************************************************/
+class PythonFactory
+{
+public:
+    PythonFactory(const std::vector<Poco::Path> &modulePaths, const std::string &moduleName,
+        const std::string &functionName, const Pothos::ProxyEnvironmentArgs &envArgs);
+
+    /*!
+     * Get the module's class (or function), cached after the first lookup.
+     * It is looked up again when the module was reloaded or the interpreter ended.
+     */
+    Pothos::Proxy resolve(void);
+
+    const std::vector<Poco::Path> modulePaths;
+    const std::string moduleName;
+    const std::string functionName;
+    const Pothos::ProxyEnvironmentArgs envArgs;
+
+private:
+    bool isCurrent(void);
+    std::mutex _mutex;
+    Pothos::Proxy _callable;
+    Pothos::Callable _isCurrent;
+};
@@ -415,11 +415,21 @@ static Pothos::ProxyVector convertPyListToVector(const Pothos::Proxy &proxy)
 {
     auto env = std::dynamic_pointer_cast<PythonProxyEnvironment>(proxy.getEnvironment());
     auto obj = std::dynamic_pointer_cast<PythonProxyHandle>(proxy.getHandle())->obj;
+    #ifdef Py_GIL_DISABLED
+    //borrowed list items are unsafe without the GIL, iterate over a snapshot
+    PyObjectRef items(PyList_AsTuple(obj), REF_NEW);
+    Pothos::ProxyVector vec(PyTuple_Size(items.obj));
+    for (size_t i = 0; i < vec.size(); i++)
+    {
+        vec[i] = env->makeHandle(PyTuple_GetItem(items.obj, i), REF_BORROWED);
+    }
+    #else
     Pothos::ProxyVector vec(PyList_Size(obj));
     for (size_t i = 0; i < vec.size(); i++)
     {
         vec[i] = env->makeHandle(PyList_GetItem(obj, i), REF_BORROWED);
     }
+    #endif
     return vec;
 }
 
@@ -6,22 +6,39 @@
 #include <iostream>
 #include "PythonProxy.hpp"
 
+//vectorcall avoids the argument tuple for small argument counts
+#if PY_VERSION_HEX >= 0x03090000
+#define POTHOS_PYTHON_VECTORCALL PyObject_Vectorcall
+#elif PY_VERSION_HEX >= 0x03080000
+#define POTHOS_PYTHON_VECTORCALL _PyObject_Vectorcall
+#endif
+
+static const size_t MAX_STACK_ARGS = 8;
+
 PythonProxyHandle::PythonProxyHandle(std::shared_ptr<PythonProxyEnvironment> env, PyObject *obj, const bool borrowed):
     env(env), obj(obj)
 {
-    PyGilStateLock lock;
+    PyInterpLock lock(env.get());
     ref = PyObjectRef(obj, borrowed);
 }
 
 PythonProxyHandle::~PythonProxyHandle(void)
 {
-    PyGilStateLock lock;
+    //cached proxies can outlive the interpreter at process exit
+    if (not env->interpreterAlive())
+    {
+        for (auto &entry : boundCalls) entry.second.obj = nullptr;
+        ref.obj = nullptr;
+        return;
+    }
+    PyInterpLock lock(env.get());
+    boundCalls.clear();
     ref = PyObjectRef();
 }
 
 int PythonProxyHandle::compareTo(const Pothos::Proxy &proxy) const
 {
-    PyGilStateLock lock;
+    PyInterpLock lock(env.get());
     int rEq = 0, rGt = 0, rLt = 0;
     rEq = PyObject_RichCompareBool(obj, env->getHandle(proxy)->obj, Py_EQ);
     if (rEq == 1) return 0;
@@ -44,58 +61,45 @@ int PythonProxyHandle::compareTo(const Pothos::Proxy &proxy) const
 
 size_t PythonProxyHandle::hashCode(void) const
 {
-    PyGilStateLock lock;
+    PyInterpLock lock(env.get());
     return size_t(PyObject_Hash(obj));
 }
 
 std::string PythonProxyHandle::toString(void) const
 {
-    PyGilStateLock lock;
+    PyInterpLock lock(env.get());
     PyObjectRef str(PyObject_Str(obj), REF_NEW);
     return PyObjToStdString(str.obj);
 }
 
 std::string PythonProxyHandle::getClassName(void) const
 {
-    PyGilStateLock lock;
-
-    PyObjectRef cls(PyObject_GetAttrString(obj, "__class__"), REF_NEW);
-    PyObjectRef clsName(PyObject_GetAttrString(cls.obj, "__name__"), REF_NEW);
-    PyObjectRef modName(PyObject_GetAttrString(cls.obj, "__module__"), REF_NEW);
-
-    const auto clsNameStr = PyObjToStdString(clsName.obj);
-    const auto modNameStr = PyObjToStdString(modName.obj);
-
-    #if PY_MAJOR_VERSION >= 3
-    if (modNameStr == "builtins") return clsNameStr;
-    #else
-    if (modNameStr == "__builtin__") return clsNameStr;
-    #endif
-
-    return modNameStr + "." + clsNameStr;
+    PyInterpLock lock(env.get());
+    return env->getClassName(obj);
 }
 
 Pothos::Proxy PythonProxyHandle::call(const std::string &name, const Pothos::Proxy *args, const size_t numArgs)
 {
-    PyGilStateLock lock;
+    PyInterpLock lock(env.get());
     if (this->obj == nullptr) throw Pothos::ProxyHandleCallError(
         "PythonProxyHandle::call("+name+")", "cant call on a null object");
 
+    const auto &callName = env->internCallName(name);
+
     /*******************************************************************
      * Step 0) handle field accessors and mutators
      ******************************************************************/
-    const auto colon = name.find(":");
-    if (colon != std::string::npos)
+    if (callName.kind != PythonCallName::CALL_SELF and callName.kind != PythonCallName::CALL_ATTR)
     {
         PyObjectRef result(Py_None, REF_BORROWED);
 
-        if (name.substr(0, colon) == "set" and numArgs == 1)
+        if (callName.kind == PythonCallName::SET_FIELD and numArgs == 1)
         {
-            PyObject_SetAttrString(this->obj, name.substr(colon+1).c_str(), env->getHandle(args[0])->obj);
+            PyObject_SetAttr(this->obj, callName.attr.obj, env->getHandle(args[0])->obj);
         }
-        else if (name.substr(0, colon) == "get" and numArgs == 0)
+        else if (callName.kind == PythonCallName::GET_FIELD and numArgs == 0)
         {
-            result = PyObjectRef(PyObject_GetAttrString(this->obj, name.substr(colon+1).c_str()), REF_NEW);
+            result = PyObjectRef(PyObject_GetAttr(this->obj, callName.attr.obj), REF_NEW);
         }
         else throw Pothos::ProxyHandleCallError(
             "PythonProxyHandle::call("+name+")", "unknown operation");
@@ -112,9 +116,18 @@ Pothos::Proxy PythonProxyHandle::call(const std::string &name, const Pothos::Pro
      * Step 1) locate the callable object
      ******************************************************************/
     PyObjectRef attrObj;
+    bool cached = false;
 
-    if (name.empty() or name == "()") attrObj = PyObjectRef(ref);
-    else attrObj = PyObjectRef(PyObject_GetAttrString(this->obj, name.c_str()), REF_NEW);
+    if (env->cacheCalls and callName.kind == PythonCallName::CALL_ATTR)
+    {
+        std::lock_guard<PyStateMutex> lock(boundCallsMutex);
+        auto it = boundCalls.find(&callName);
+        cached = it != boundCalls.end();
+        if (cached) attrObj = it->second;
+    }
+
+    if (callName.kind == PythonCallName::CALL_SELF) attrObj = PyObjectRef(ref);
+    else if (not cached) attrObj = PyObjectRef(PyObject_GetAttr(this->obj, callName.attr.obj), REF_NEW);
 
     if (attrObj.obj == nullptr)
     {
@@ -131,21 +144,53 @@ Pothos::Proxy PythonProxyHandle::call(const std::string &name, const Pothos::Pro
             Poco::format("cant call on %s", this->toString()));
     }
 
-    /*******************************************************************
-     * Step 2) create tuple of arguments
-     ******************************************************************/
-    PyObjectRef argsObj(PyTuple_New(numArgs), REF_NEW);
-    std::vector<std::shared_ptr<PythonProxyHandle>> argHandles(numArgs);
-    for (size_t i = 0; i < numArgs; i++)
+    if (env->cacheCalls and callName.kind == PythonCallName::CALL_ATTR and not cached)
     {
-        argHandles[i] = env->getHandle(args[i]);
-        PyTuple_SetItem(argsObj.obj, i, argHandles[i]->ref.newRef());
+        std::lock_guard<PyStateMutex> lock(boundCallsMutex);
+        boundCalls.emplace(&callName, attrObj);
     }
 
-    /*******************************************************************
-     * Step 4) call into the callable object
-     ******************************************************************/
-    PyObjectRef result(PyObject_CallObject(attrObj.obj, argsObj.obj), REF_NEW);
+    PyObjectRef result;
+
+    #ifdef POTHOS_PYTHON_VECTORCALL
+    if (numArgs <= MAX_STACK_ARGS)
+    {
+        /***************************************************************
+         * Step 2) stack array of arguments (slot 0 reserved for callee)
+         **************************************************************/
+        std::shared_ptr<PythonProxyHandle> argHandles[MAX_STACK_ARGS];
+        PyObject *argv[MAX_STACK_ARGS+1];
+        for (size_t i = 0; i < numArgs; i++)
+        {
+            argHandles[i] = env->getHandle(args[i]);
+            argv[i+1] = argHandles[i]->obj;
+        }
+
+        /***************************************************************
+         * Step 4) call into the callable object
+         **************************************************************/
+        result = PyObjectRef(POTHOS_PYTHON_VECTORCALL(attrObj.obj, argv+1,
+            numArgs | PY_VECTORCALL_ARGUMENTS_OFFSET, nullptr), REF_NEW);
+    }
+    else
+    #endif
+    {
+        /***************************************************************
+         * Step 2) create tuple of arguments
+         **************************************************************/
+        PyObjectRef argsObj(PyTuple_New(numArgs), REF_NEW);
+        std::vector<std::shared_ptr<PythonProxyHandle>> argHandles(numArgs);
+        for (size_t i = 0; i < numArgs; i++)
+        {
+            argHandles[i] = env->getHandle(args[i]);
+            PyTuple_SetItem(argsObj.obj, i, argHandles[i]->ref.newRef());
+        }
+
+        /***************************************************************
+         * Step 4) call into the callable object
+         **************************************************************/
+        result = PyObjectRef(PyObject_CallObject(attrObj.obj, argsObj.obj), REF_NEW);
+    }
 
     /*******************************************************************
      * Step 5) exception handling and reporting
@@ -157,6 +202,6 @@ Pothos::Proxy PythonProxyHandle::call(const std::string &name, const Pothos::Pro
     }
 
     auto x = env->makeHandle(result);
-    if (x.getClassName() == "PothosProxy") return x.convert<Pothos::Proxy>();
+    if (env->isPothosProxy(result.obj)) return x.convert<Pothos::Proxy>();
     return x;
 }
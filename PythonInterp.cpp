@@ -0,0 +1,341 @@
+// Copyright (c) 2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "PythonSupport.hpp"
+#include "PythonProxy.hpp"
+#include <Pothos/System/Paths.hpp>
+#include <Poco/Path.h>
+#include <vector>
+
+//per-interpreter GIL support requires python 3.12
+#if PY_VERSION_HEX >= 0x030C0000
+#define POTHOS_PYTHON_SUBINTERPRETERS
+#endif
+
+#ifdef POTHOS_PYTHON_SUBINTERPRETERS
+static PyThreadState *currentThreadState(void)
+{
+    #if PY_VERSION_HEX >= 0x030D0000
+    return PyThreadState_GetUnchecked();
+    #else
+    return _PyThreadState_UncheckedGet();
+    #endif
+}
+
+/*!
+ * Activating a sub-interpreter state rebinds the thread's GILState slot,
+ * after which PyGILState_Ensure() re-enters the sub-interpreter.
+ * The main interpreter is entered through a state kept per thread instead.
+ */
+struct PythonMainThreadState
+{
+    PythonMainThreadState(void):
+        threadState(nullptr)
+    {
+        return;
+    }
+
+    ~PythonMainThreadState(void)
+    {
+        if (threadState == nullptr or not Py_IsInitialized()) return;
+        if (currentThreadState() != nullptr) return; //cannot switch states at exit
+        PyEval_RestoreThread(threadState);
+        PyThreadState_Clear(threadState);
+        PyThreadState_DeleteCurrent();
+    }
+
+    PyThreadState *get(void)
+    {
+        if (threadState == nullptr) threadState = PyThreadState_New(PyInterpreterState_Main());
+        return threadState;
+    }
+
+    PyThreadState *threadState;
+};
+
+static thread_local PythonMainThreadState mainThreadState;
+#endif
+
+/***********************************************************************
+ * Interpreter lock for an environment
+ **********************************************************************/
+PyInterpLock::PyInterpLock(const PythonProxyEnvironment *env):
+    _interp(env->hasParentInterpreter? env->parentInterpreter.lock() : env->subInterpreter),
+    _prev(nullptr),
+    _entered(false)
+{
+    if (env->hasParentInterpreter and not _interp)
+    {
+        throw Pothos::Exception("PyInterpLock()", "the python sub-interpreter has ended");
+    }
+    if (_interp)
+    {
+        _entered = _interp->enter(_prev);
+        return;
+    }
+
+    #ifdef POTHOS_PYTHON_SUBINTERPRETERS
+    //already in the main interpreter, or step out of any other into it
+    auto current = currentThreadState();
+    if (current != nullptr and PyThreadState_GetInterpreter(current) == PyInterpreterState_Main()) return;
+    _prev = (current == nullptr)? nullptr : PyEval_SaveThread();
+    PyEval_RestoreThread(mainThreadState.get());
+    _entered = true;
+    #else
+    _s = PyGILState_Ensure();
+    #endif
+}
+
+PyInterpLock::~PyInterpLock(void)
+{
+    if (_interp)
+    {
+        if (_entered) _interp->exit(_prev);
+        return;
+    }
+
+    #ifdef POTHOS_PYTHON_SUBINTERPRETERS
+    if (not _entered) return;
+    PyEval_SaveThread();
+    if (_prev != nullptr) PyEval_RestoreThread(_prev);
+    #else
+    PyGILState_Release(_s);
+    #endif
+}
+
+/***********************************************************************
+ * Sub-interpreter lifetime
+ **********************************************************************/
+struct PythonSubInterpreterRegistry
+{
+    std::mutex mutex;
+    std::map<std::string, std::weak_ptr<PythonSubInterpreter>> groups;
+    std::map<PyInterpreterState *, std::weak_ptr<PythonSubInterpreter>> interps;
+};
+
+static PythonSubInterpreterRegistry &getSubInterpreterRegistry(void)
+{
+    static PythonSubInterpreterRegistry registry;
+    return registry;
+}
+
+/*!
+ * Thread states of sub-interpreters are created per calling thread.
+ * The reaper deletes a thread's states when the thread exits so that
+ * short-lived threads do not accumulate states until the interpreter ends.
+ */
+struct PythonThreadStateReaper
+{
+    ~PythonThreadStateReaper(void)
+    {
+        for (const auto &weak : interps)
+        {
+            auto interp = weak.lock();
+            if (interp) interp->deleteThreadState();
+        }
+    }
+
+    void watch(const std::shared_ptr<PythonSubInterpreter> &interp)
+    {
+        std::vector<std::weak_ptr<PythonSubInterpreter>> live;
+        for (const auto &weak : interps)
+        {
+            auto other = weak.lock();
+            if (other == interp) return;
+            if (other) live.push_back(other);
+        }
+        live.push_back(interp);
+        interps.swap(live);
+    }
+
+    std::vector<std::weak_ptr<PythonSubInterpreter>> interps;
+};
+
+static thread_local PythonThreadStateReaper threadStateReaper;
+
+std::shared_ptr<PythonSubInterpreter> PythonSubInterpreter::make(const std::string &group)
+{
+    //interpreters are shared by name while any environment uses them
+    auto &registry = getSubInterpreterRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto interp = registry.groups[group].lock();
+    if (not interp)
+    {
+        interp.reset(new PythonSubInterpreter());
+        registry.groups[group] = interp;
+        registry.interps[interp->_interp] = interp;
+        threadStateReaper.watch(interp); //the creating thread has a state
+    }
+    return interp;
+}
+
+std::shared_ptr<PythonSubInterpreter> PythonSubInterpreter::current(void)
+{
+    #ifdef POTHOS_PYTHON_SUBINTERPRETERS
+    auto threadState = currentThreadState();
+    if (threadState == nullptr) return nullptr;
+    auto interp = PyThreadState_GetInterpreter(threadState);
+    if (interp == PyInterpreterState_Main()) return nullptr;
+    auto &registry = getSubInterpreterRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto it = registry.interps.find(interp);
+    if (it != registry.interps.end()) return it->second.lock();
+    #endif
+    return nullptr;
+}
+
+#ifdef POTHOS_PYTHON_SUBINTERPRETERS
+
+PythonSubInterpreter::PythonSubInterpreter(void):
+    _interp(nullptr)
+{
+    PyInterpreterConfig config;
+    config.use_main_obmalloc = 0;
+    config.allow_fork = 0;
+    config.allow_exec = 0;
+    config.allow_threads = 1;
+    config.allow_daemon_threads = 0;
+    config.check_multi_interp_extensions = 1;
+    config.gil = PyInterpreterConfig_OWN_GIL;
+
+    //created from the main interpreter, whose GIL is released while the new one is current
+    auto current = currentThreadState();
+    PyThreadState *prev = (current == nullptr)? nullptr : PyEval_SaveThread();
+    PyEval_RestoreThread(mainThreadState.get());
+    PyThreadState *threadState = nullptr;
+    const auto status = Py_NewInterpreterFromConfig(&threadState, &config);
+    if (PyStatus_Exception(status))
+    {
+        PyEval_SaveThread();
+        if (prev != nullptr) PyEval_RestoreThread(prev);
+        throw Pothos::Exception("PythonSubInterpreter()", (status.err_msg == nullptr)? "Py_NewInterpreterFromConfig" : status.err_msg);
+    }
+    _interp = PyThreadState_GetInterpreter(threadState);
+    _threadStates[std::this_thread::get_id()] = threadState;
+
+    //same setup as the main interpreter in makePythonProxyEnvironment()
+    Poco::Path pythonPath(Pothos::System::getRootPath());
+    pythonPath.append(POTHOS_PYTHON_DIR);
+    PySys_SetObject("dont_write_bytecode", Py_True);
+    PyObjectRef path(StdStringToPyObject(pythonPath.toString()), REF_NEW);
+    PyList_Append(PySys_GetObject("path"), path.obj);
+    path = PyObjectRef();
+
+    PyEval_SaveThread();
+    if (prev != nullptr) PyEval_RestoreThread(prev);
+}
+
+PythonSubInterpreter::~PythonSubInterpreter(void)
+{
+    {
+        auto &registry = getSubInterpreterRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        auto it = registry.interps.find(_interp);
+        if (it != registry.interps.end() and it->second.expired()) registry.interps.erase(it);
+    }
+    if (not Py_IsInitialized()) return;
+
+    //step out of the current interpreter and into this one
+    PyThreadState *prev = nullptr;
+    if (currentThreadState() != nullptr) prev = PyEval_SaveThread();
+    auto threadState = this->getThreadState(false);
+    PyEval_RestoreThread(threadState);
+
+    //the ending thread state must be the last one in the interpreter
+    for (const auto &pair : _threadStates)
+    {
+        if (pair.second == threadState) continue;
+        PyThreadState_Clear(pair.second);
+        PyThreadState_Delete(pair.second);
+    }
+    Py_EndInterpreter(threadState);
+    _threadStates.clear();
+
+    if (prev != nullptr) PyEval_RestoreThread(prev);
+}
+
+bool PythonSubInterpreter::enter(PyThreadState *&prev)
+{
+    auto threadState = this->getThreadState();
+    auto current = currentThreadState();
+    if (current == threadState) return false;
+    prev = (current == nullptr)? nullptr : PyEval_SaveThread();
+    PyEval_RestoreThread(threadState);
+    return true;
+}
+
+void PythonSubInterpreter::exit(PyThreadState *prev)
+{
+    PyEval_SaveThread();
+    if (prev != nullptr) PyEval_RestoreThread(prev);
+}
+
+void PythonSubInterpreter::deleteThreadState(void)
+{
+    if (not Py_IsInitialized()) return;
+
+    //a thread exiting with a state still current cannot delete it
+    if (currentThreadState() != nullptr) return;
+    PyThreadState *threadState = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _threadStates.find(std::this_thread::get_id());
+        if (it == _threadStates.end()) return;
+        threadState = it->second;
+        _threadStates.erase(it);
+    }
+
+    //the GIL is taken outside of the mutex, a thread in the interpreter may need it
+    PyEval_RestoreThread(threadState);
+    PyThreadState_Clear(threadState);
+    PyThreadState_DeleteCurrent();
+}
+
+PyThreadState *PythonSubInterpreter::getThreadState(const bool reap)
+{
+    //one thread state per calling thread, deleted when the thread exits
+    PyThreadState *threadState = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto &state = _threadStates[std::this_thread::get_id()];
+        if (state != nullptr) return state;
+        threadState = state = PyThreadState_New(_interp);
+    }
+    if (reap) threadStateReaper.watch(this->shared_from_this());
+    return threadState;
+}
+
+#else //POTHOS_PYTHON_SUBINTERPRETERS
+
+PythonSubInterpreter::PythonSubInterpreter(void):
+    _interp(nullptr)
+{
+    throw Pothos::Exception("PythonSubInterpreter()", "sub-interpreters with their own GIL require python 3.12");
+}
+
+PythonSubInterpreter::~PythonSubInterpreter(void)
+{
+    return;
+}
+
+bool PythonSubInterpreter::enter(PyThreadState *&)
+{
+    return false;
+}
+
+void PythonSubInterpreter::exit(PyThreadState *)
+{
+    return;
+}
+
+void PythonSubInterpreter::deleteThreadState(void)
+{
+    return;
+}
+
+PyThreadState *PythonSubInterpreter::getThreadState(const bool)
+{
+    return nullptr;
+}
+
+#endif //POTHOS_PYTHON_SUBINTERPRETERS
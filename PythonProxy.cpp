@@ -4,11 +4,17 @@
 
 #include "PythonSupport.hpp"
 #include "PythonProxy.hpp"
+#include "PythonStartup.hpp"
 #include <Pothos/Plugin.hpp>
 #include <Pothos/Callable.hpp>
 #include <Poco/SingletonHolder.h>
 #include <Pothos/System/Paths.hpp>
 #include <Poco/Path.h>
+#include <marshal.h>
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <vector>
 
 /***********************************************************************
  * Per process Python interp init and cleanup
@@ -18,6 +24,7 @@ struct PythonInterpWrapper
     PythonInterpWrapper(void):
         _s(nullptr)
     {
+        PythonStartupTimer timer("Py_Initialize");
         Py_Initialize();
 #if PY_VERSION_HEX < 0x03070000
         // Python 3.7: automatically called by Py_Initialize()
@@ -45,11 +52,129 @@ static PythonInterpWrapper &getPythonInterpWrapper(void)
 /***********************************************************************
  * PythonProxyEnvironment methods
  **********************************************************************/
-PythonProxyEnvironment::PythonProxyEnvironment(const Pothos::ProxyEnvironmentArgs &)
+PythonProxyEnvironment::PythonProxyEnvironment(const Pothos::ProxyEnvironmentArgs &args):
+    cacheCalls(args.count("cache_calls") != 0 and args.at("cache_calls") == "true"),
+    subInterpreter((args.count("interpreter") != 0)? PythonSubInterpreter::make(args.at("interpreter")) : nullptr),
+    parentInterpreter((args.count("interpreter") != 0)? nullptr : PythonSubInterpreter::current()),
+    hasParentInterpreter(not parentInterpreter.expired())
 {
     return;
 }
 
+PythonProxyEnvironment::~PythonProxyEnvironment(void)
+{
+    //the interned names can outlive the interpreter at process exit
+    if (not this->interpreterAlive())
+    {
+        for (auto &entry : _callNames) entry.second.attr.obj = nullptr;
+        for (auto &entry : _classNames) entry.second.first.obj = nullptr;
+        _proxyType.obj = nullptr;
+        return;
+    }
+    PyInterpLock lock(this);
+    _callNames.clear();
+    _classNames.clear();
+    _proxyType = PyObjectRef();
+}
+
+bool PythonProxyEnvironment::interpreterAlive(void) const
+{
+    if (not Py_IsInitialized()) return false;
+    return not hasParentInterpreter or not parentInterpreter.expired();
+}
+
+static PyObject *internString(const std::string &s)
+{
+    #if PY_MAJOR_VERSION >= 3
+    return PyUnicode_InternFromString(s.c_str());
+    #else
+    return PyString_InternFromString(s.c_str());
+    #endif
+}
+
+const PythonCallName &PythonProxyEnvironment::internCallName(const std::string &name)
+{
+    {
+        std::lock_guard<PyStateMutex> lock(_cacheMutex);
+        auto it = _callNames.find(name);
+        if (it != _callNames.end()) return it->second;
+    }
+
+    PythonCallName callName;
+    const auto colon = name.find(":");
+    if (name.empty() or name == "()") callName.kind = PythonCallName::CALL_SELF;
+    else if (colon == std::string::npos) callName.kind = PythonCallName::CALL_ATTR;
+    else if (name.substr(0, colon) == "get") callName.kind = PythonCallName::GET_FIELD;
+    else if (name.substr(0, colon) == "set") callName.kind = PythonCallName::SET_FIELD;
+    else callName.kind = PythonCallName::UNKNOWN_OP;
+
+    if (callName.kind != PythonCallName::CALL_SELF)
+    {
+        const auto attrName = (colon == std::string::npos)? name : name.substr(colon+1);
+        callName.attr = PyObjectRef(internString(attrName), REF_NEW);
+    }
+
+    //map nodes are stable, and a racing thread may have inserted first
+    std::lock_guard<PyStateMutex> lock(_cacheMutex);
+    return _callNames.emplace(name, callName).first->second;
+}
+
+const std::string &PythonProxyEnvironment::getClassName(PyObject *obj)
+{
+    //the cache holds a type reference so the pointer key cannot be reused
+    auto type = Py_TYPE(obj);
+    {
+        std::lock_guard<PyStateMutex> lock(_cacheMutex);
+        auto it = _classNames.find(type);
+        if (it != _classNames.end()) return it->second.second;
+    }
+
+    PyObjectRef clsName(PyObject_GetAttrString((PyObject *)type, "__name__"), REF_NEW);
+    PyObjectRef modName(PyObject_GetAttrString((PyObject *)type, "__module__"), REF_NEW);
+
+    const auto clsNameStr = PyObjToStdString(clsName.obj);
+    const auto modNameStr = PyObjToStdString(modName.obj);
+
+    #if PY_MAJOR_VERSION >= 3
+    const bool builtin = modNameStr == "builtins";
+    #else
+    const bool builtin = modNameStr == "__builtin__";
+    #endif
+
+    auto entry = std::make_pair(PyObjectRef((PyObject *)type, REF_BORROWED), builtin? clsNameStr : modNameStr + "." + clsNameStr);
+    std::lock_guard<PyStateMutex> lock(_cacheMutex);
+    return _classNames.emplace(type, entry).first->second.second;
+}
+
+bool PythonProxyEnvironment::isPothosProxy(PyObject *obj)
+{
+    //each interpreter that imports the PothosModule creates its own type
+    {
+        std::lock_guard<PyStateMutex> lock(_cacheMutex);
+        if (_proxyType.obj != nullptr) return Py_TYPE(obj) == (PyTypeObject *)_proxyType.obj;
+    }
+
+    //no instances can exist before the module is imported
+    #if PY_VERSION_HEX >= 0x03070000
+    PyObjectRef name(StdStringToPyObject("Pothos.PothosModule"), REF_NEW);
+    PyObjectRef module(PyImport_GetModule(name.obj), REF_NEW);
+    #else
+    PyObjectRef module(PyDict_GetItemString(PyImport_GetModuleDict(), "Pothos.PothosModule"), REF_BORROWED);
+    #endif
+    PyErr_Clear();
+    if (module.obj == nullptr) return false;
+    PyObjectRef type(PyObject_GetAttrString(module.obj, "Proxy"), REF_NEW);
+    if (type.obj == nullptr)
+    {
+        PyErr_Clear();
+        return false;
+    }
+
+    std::lock_guard<PyStateMutex> lock(_cacheMutex);
+    if (_proxyType.obj == nullptr) _proxyType = type;
+    return Py_TYPE(obj) == (PyTypeObject *)_proxyType.obj;
+}
+
 Pothos::Proxy PythonProxyEnvironment::makeHandle(PyObject *obj, const bool borrowed)
 {
     auto env = std::dynamic_pointer_cast<PythonProxyEnvironment>(this->shared_from_this());
@@ -63,7 +188,7 @@ Pothos::Proxy PythonProxyEnvironment::makeHandle(const PyObjectRef &ref)
 
 std::shared_ptr<PythonProxyHandle> PythonProxyEnvironment::getHandle(const Pothos::Proxy &proxy)
 {
-    PyGilStateLock lock;
+    PyInterpLock lock(this);
     Pothos::Proxy myProxy = proxy;
     if (proxy.getEnvironment() != this->shared_from_this())
     {
@@ -76,7 +201,7 @@ std::shared_ptr<PythonProxyHandle> PythonProxyEnvironment::getHandle(const Potho
 
 Pothos::Proxy PythonProxyEnvironment::findProxy(const std::string &name)
 {
-    PyGilStateLock lock;
+    PyInterpLock lock(this);
     PyObjectRef module(PyImport_ImportModule(name.c_str()), REF_NEW);
     if (module.obj == nullptr) throw Pothos::ProxyEnvironmentFindError(
         "PythonProxyEnvironment::findProxy("+name+")", getErrorString());
@@ -85,7 +210,7 @@ Pothos::Proxy PythonProxyEnvironment::findProxy(const std::string &name)
 
 Pothos::Proxy PythonProxyEnvironment::convertObjectToProxy(const Pothos::Object &local)
 {
-    PyGilStateLock lock;
+    PyInterpLock lock(this);
     try
     {
         return Pothos::ProxyEnvironment::convertObjectToProxy(local);
@@ -100,43 +225,336 @@ Pothos::Proxy PythonProxyEnvironment::convertObjectToProxy(const Pothos::Object
 
 Pothos::Object PythonProxyEnvironment::convertProxyToObject(const Pothos::Proxy &proxy)
 {
-    PyGilStateLock lock;
+    PyInterpLock lock(this);
     auto r = Pothos::ProxyEnvironment::convertProxyToObject(proxy);
     if (r.type() == typeid(Pothos::Object)) return r.extract<Pothos::Object>();
     return r;
 }
 
+/***********************************************************************
+ * Serialization framing: a magic tag then size prefixed parts,
+ * so deserialize reads exactly one object without seeking.
+ * Pickle protocol 5 writes the out-of-band buffers from their own memory.
+ * Objects that pickle rejects, such as code objects, use framed marshal.
+ *
+ * Compatibility: unframed marshal data from older versions is still read,
+ * but older versions cannot read the framed PYP5 or PYM1 streams,
+ * and PYP5 streams can only be read by python 3.8 and later.
+ **********************************************************************/
+static const char PICKLE5_MAGIC[4] = {'P', 'Y', 'P', '5'};
+static const char MARSHAL_MAGIC[4] = {'P', 'Y', 'M', '1'};
+
+static void writeSize(std::ostream &os, const unsigned long long size)
+{
+    char bytes[8];
+    for (size_t i = 0; i < sizeof(bytes); i++) bytes[i] = char((size >> (8*i)) & 0xff);
+    os.write(bytes, sizeof(bytes));
+}
+
+static unsigned long long readSize(std::istream &is)
+{
+    unsigned char bytes[8];
+    if (not is.read((char *)bytes, sizeof(bytes))) throw Pothos::Exception("readSize()", "unexpected end of stream");
+    unsigned long long size(0);
+    for (size_t i = 0; i < sizeof(bytes); i++) size |= ((unsigned long long)bytes[i]) << (8*i);
+    return size;
+}
+
+//! bytes left in a seekable stream, or -1 when the stream cannot seek
+static long long getStreamRemaining(std::istream &is)
+{
+    const auto pos = is.tellg();
+    if (pos == std::istream::pos_type(-1))
+    {
+        is.clear();
+        return -1;
+    }
+    is.seekg(0, std::ios::end);
+    const auto end = is.tellg();
+    is.seekg(pos);
+    if (not is or end == std::istream::pos_type(-1))
+    {
+        is.clear();
+        is.seekg(pos);
+        return -1;
+    }
+    return (long long)(end - pos);
+}
+
+/*!
+ * Received parts: each bytearray is allocated with the interpreter held,
+ * filled from the stream without it, and released with the interpreter
+ * held again. Arrays are rebuilt over the memory of the buffer parts.
+ */
+struct DeserializedData
+{
+    DeserializedData(const PythonProxyEnvironment *env):
+        env(env)
+    {
+        return;
+    }
+
+    ~DeserializedData(void)
+    {
+        if (not env->interpreterAlive()) return;
+        try
+        {
+            PyInterpLock lock(env);
+            for (auto part : parts) Py_DECREF(part);
+        }
+        catch (const Pothos::Exception &){}
+    }
+
+    //! read a size prefixed part into a new bytearray
+    PyObject *readPart(std::istream &is)
+    {
+        const auto length = readSize(is);
+        const auto remaining = getStreamRemaining(is);
+        if (length > (unsigned long long)PY_SSIZE_T_MAX or
+            (remaining >= 0 and length > (unsigned long long)remaining))
+        {
+            throw Pothos::Exception("readPart()", "part size "+std::to_string(length)+" exceeds the stream");
+        }
+
+        //a stream that cannot seek is read in growing chunks,
+        //so a corrupt size fails at the end of the stream instead of allocating it
+        const auto chunk = Py_ssize_t((remaining >= 0)? length : std::min<unsigned long long>(length, 1 << 20));
+        parts.reserve(parts.size()+1);
+        {
+            PyInterpLock lock(env);
+            parts.push_back(PyByteArray_FromStringAndSize(nullptr, chunk));
+            if (parts.back() == nullptr)
+            {
+                parts.pop_back();
+                throw Pothos::Exception("readPart()", getErrorString());
+            }
+        }
+
+        PyObject *part = parts.back();
+        Py_ssize_t offset(0);
+        while (true)
+        {
+            const auto size = PyByteArray_GET_SIZE(part);
+            if (size != offset and not is.read(PyByteArray_AS_STRING(part)+offset, size-offset))
+            {
+                throw Pothos::Exception("readPart()", "unexpected end of stream");
+            }
+            offset = size;
+            if ((unsigned long long)offset == length) return part;
+
+            PyInterpLock lock(env);
+            const auto next = Py_ssize_t(std::min<unsigned long long>(length, (unsigned long long)offset*2));
+            if (PyByteArray_Resize(part, next) != 0) throw Pothos::Exception("readPart()", getErrorString());
+        }
+    }
+
+    const PythonProxyEnvironment *env;
+    std::vector<PyObject *> parts;
+};
+
+/*!
+ * Serialized bytes and the views of out-of-band buffers:
+ * filled with the interpreter held, written to the stream without it,
+ * and released with the interpreter held again.
+ */
+struct SerializedData
+{
+    SerializedData(const PythonProxyEnvironment *env):
+        env(env),
+        magic(nullptr)
+    {
+        return;
+    }
+
+    ~SerializedData(void)
+    {
+        if (not env->interpreterAlive())
+        {
+            data.obj = nullptr;
+            return;
+        }
+        try
+        {
+            PyInterpLock lock(env);
+            for (auto &view : views) PyBuffer_Release(&view);
+            data = PyObjectRef();
+        }
+        catch (const Pothos::Exception &)
+        {
+            data.obj = nullptr;
+        }
+    }
+
+    const PythonProxyEnvironment *env;
+    const char *magic;
+    PyObjectRef data;
+    std::vector<Py_buffer> views;
+};
+
+static void writeSerialized(std::ostream &os, const SerializedData &out)
+{
+    os.write(out.magic, 4);
+    writeSize(os, PyBytes_GET_SIZE(out.data.obj));
+    os.write(PyBytes_AS_STRING(out.data.obj), PyBytes_GET_SIZE(out.data.obj));
+    if (out.magic != PICKLE5_MAGIC) return;
+    writeSize(os, out.views.size());
+    for (const auto &view : out.views)
+    {
+        writeSize(os, view.len);
+        os.write((const char *)view.buf, view.len);
+    }
+}
+
+//! false with the python error set when marshal rejects the object
+static bool dumpsMarshal(PyObject *obj, SerializedData &out)
+{
+    out.data = PyObjectRef(PyMarshal_WriteObjectToString(obj, Py_MARSHAL_VERSION), REF_NEW);
+    out.magic = MARSHAL_MAGIC;
+    return out.data.obj != nullptr;
+}
+
+static PyObject *loadsMarshal(const char *data, const size_t length)
+{
+    PyObject *obj = PyMarshal_ReadObjectFromString(const_cast<char *>(data), Py_ssize_t(length));
+    if (obj == nullptr) throw Pothos::Exception("marshal.loads", getErrorString());
+    return obj;
+}
+
+#if PY_VERSION_HEX >= 0x03080000
+//! false with the python error set when pickle rejects the object
+static bool dumpsPickle5(PyObject *obj, SerializedData &out)
+{
+    PyObjectRef pickle(PyImport_ImportModule("pickle"), REF_NEW);
+    PyObjectRef dumps((pickle.obj == nullptr)? nullptr : PyObject_GetAttrString(pickle.obj, "dumps"), REF_NEW);
+    PyObjectRef buffers(PyList_New(0), REF_NEW);
+    PyObjectRef callback(PyObject_GetAttrString(buffers.obj, "append"), REF_NEW);
+    if (dumps.obj == nullptr or callback.obj == nullptr) throw Pothos::Exception("pickle.dumps", getErrorString());
+
+    PyObjectRef args(PyTuple_Pack(1, obj), REF_NEW);
+    PyObjectRef kwargs(Py_BuildValue("{s:i,s:O}", "protocol", 5, "buffer_callback", callback.obj), REF_NEW);
+    out.data = PyObjectRef(PyObject_Call(dumps.obj, args.obj, kwargs.obj), REF_NEW);
+    if (out.data.obj == nullptr) return false;
+    out.magic = PICKLE5_MAGIC;
+
+    //the views keep the buffer memory valid while it is written
+    out.views.reserve(size_t(PyList_GET_SIZE(buffers.obj)));
+    for (Py_ssize_t i = 0; i < PyList_GET_SIZE(buffers.obj); i++)
+    {
+        Py_buffer view;
+        if (PyObject_GetBuffer(PyList_GET_ITEM(buffers.obj, i), &view, PyBUF_ANY_CONTIGUOUS) != 0)
+        {
+            throw Pothos::Exception("pickle.PickleBuffer", getErrorString());
+        }
+        out.views.push_back(view);
+    }
+    return true;
+}
+
+static PyObject *loadsPickle5(const std::vector<PyObject *> &parts)
+{
+    //arrays are reconstructed over the writable memory of the received bytearrays
+    PyObjectRef buffers(PyList_New(0), REF_NEW);
+    for (size_t i = 1; i < parts.size(); i++) PyList_Append(buffers.obj, parts[i]);
+
+    PyObjectRef pickle(PyImport_ImportModule("pickle"), REF_NEW);
+    PyObjectRef loads((pickle.obj == nullptr)? nullptr : PyObject_GetAttrString(pickle.obj, "loads"), REF_NEW);
+    if (loads.obj == nullptr) throw Pothos::Exception("pickle.loads", getErrorString());
+    PyObjectRef args(PyTuple_Pack(1, parts.front()), REF_NEW);
+    PyObjectRef kwargs(Py_BuildValue("{s:O}", "buffers", buffers.obj), REF_NEW);
+    PyObjectRef result(PyObject_Call(loads.obj, args.obj, kwargs.obj), REF_NEW);
+    if (result.obj == nullptr) throw Pothos::Exception("pickle.loads", getErrorString());
+    return result.newRef();
+}
+#endif
+
 void PythonProxyEnvironment::serialize(const Pothos::Proxy &proxy, std::ostream &os)
 {
     try
     {
-        auto marshal = this->findProxy("marshal");
-        const std::vector<char> data = marshal.call("dumps", proxy);
-        os.write(data.data(), data.size());
+        auto handle = this->getHandle(proxy);
+        SerializedData out(this);
+        {
+            PyInterpLock lock(this);
+            #if PY_VERSION_HEX >= 0x03080000
+            if (not dumpsPickle5(handle->obj, out))
+            {
+                //code objects and other types rejected by pickle use marshal
+                const auto pickleError = getErrorString();
+                if (not dumpsMarshal(handle->obj, out))
+                {
+                    PyErr_Clear();
+                    throw Pothos::Exception("pickle.dumps", pickleError);
+                }
+            }
+            #else
+            if (not dumpsMarshal(handle->obj, out)) throw Pothos::Exception("marshal.dumps", getErrorString());
+            #endif
+        }
+        writeSerialized(os, out);
     }
     catch (const Pothos::Exception &ex)
     {
         throw Pothos::ProxySerializeError("PythonProxyEnvironment::serialize()", ex);
     }
+    catch (const std::exception &ex)
+    {
+        throw Pothos::ProxySerializeError("PythonProxyEnvironment::serialize()", ex.what());
+    }
 }
 
 Pothos::Proxy PythonProxyEnvironment::deserialize(std::istream &is)
 {
-    is.seekg (0, std::ios_base::end);
-    const auto length = is.tellg();
-    is.seekg (0, std::ios_base::beg);
-    std::vector<char> bytes(length);
-    is.read(bytes.data(), bytes.size());
-
     try
     {
-        auto marshal = this->findProxy("marshal");
-        return marshal.call("loads", bytes);
+        //read the whole object before taking the interpreter
+        char magic[4];
+        const bool hasMagic = bool(is.read(magic, sizeof(magic)));
+        const bool isPickle5 = hasMagic and std::equal(magic, magic+sizeof(magic), PICKLE5_MAGIC);
+        std::string legacy;
+        DeserializedData in(this);
+        if (isPickle5)
+        {
+            #if PY_VERSION_HEX < 0x03080000
+            throw Pothos::Exception("pickle protocol 5 requires python 3.8");
+            #endif
+            in.readPart(is);
+            const auto numBuffers = readSize(is);
+            const auto remaining = getStreamRemaining(is);
+            if (remaining >= 0 and numBuffers > (unsigned long long)remaining/8)
+            {
+                throw Pothos::Exception("buffer count "+std::to_string(numBuffers)+" exceeds the stream");
+            }
+            for (unsigned long long i = 0; i < numBuffers; i++) in.readPart(is);
+        }
+        else if (hasMagic and std::equal(magic, magic+sizeof(magic), MARSHAL_MAGIC))
+        {
+            in.readPart(is);
+        }
+        else //unframed marshal data from older versions spans the rest of the stream
+        {
+            legacy.assign(magic, size_t(is.gcount()));
+            is.clear();
+            legacy.append(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+        }
+
+        PyInterpLock lock(this);
+        PyObject *obj = nullptr;
+        #if PY_VERSION_HEX >= 0x03080000
+        if (isPickle5) obj = loadsPickle5(in.parts);
+        else
+        #endif
+        if (not in.parts.empty()) obj = loadsMarshal(PyByteArray_AS_STRING(in.parts.front()), size_t(PyByteArray_GET_SIZE(in.parts.front())));
+        else obj = loadsMarshal(legacy.data(), legacy.size());
+        return this->makeHandle(obj, REF_NEW);
     }
     catch (const Pothos::Exception &ex)
     {
         throw Pothos::ProxySerializeError("PythonProxyEnvironment::deserialize()", ex);
     }
+    catch (const std::exception &ex)
+    {
+        throw Pothos::ProxySerializeError("PythonProxyEnvironment::deserialize()", ex.what());
+    }
 }
 
 /***********************************************************************
@@ -144,13 +562,14 @@ Pothos::Proxy PythonProxyEnvironment::deserialize(std::istream &is)
  **********************************************************************/
 Pothos::ProxyEnvironment::Sptr makePythonProxyEnvironment(const Pothos::ProxyEnvironmentArgs &args)
 {
-    auto env = Pothos::ProxyEnvironment::Sptr(new PythonProxyEnvironment(args));
-
     //The interpreter might already be initialized if python is the caller
-    if (Py_IsInitialized()) return env;
+    if (Py_IsInitialized()) return Pothos::ProxyEnvironment::Sptr(new PythonProxyEnvironment(args));
 
     getPythonInterpWrapper();
 
+    //setup the main interpreter before any sub-interpreter is created
+    PythonStartupTimer sysTimer("sys setup");
+    auto env = Pothos::ProxyEnvironment::Sptr(new PythonProxyEnvironment(Pothos::ProxyEnvironmentArgs()));
     auto sys = env->findProxy("sys");
     sys.call("set:dont_write_bytecode", true);
 
@@ -159,10 +578,14 @@ Pothos::ProxyEnvironment::Sptr makePythonProxyEnvironment(const Pothos::ProxyEnv
 
     auto sysPath = sys.call("get:path");
     sysPath.call("append", pythonPath.toString());
+    sysTimer.stop();
 
+    PythonStartupTimer importTimer("import Pothos");
     env->findProxy("Pothos"); //registers important converters
+    importTimer.stop();
 
-    return env;
+    if (args.empty()) return env;
+    return Pothos::ProxyEnvironment::Sptr(new PythonProxyEnvironment(args));
 }
 
 pothos_static_block(pothosRegisterPythonProxy)
@@ -7,44 +7,63 @@
 #include <Pothos/Proxy.hpp>
 #include <Pothos/Callable.hpp>
 #include <string>
+#include <unordered_map>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 class PythonProxyHandle;
 
-inline std::string PyObjToStdString(PyObject *o)
-{
-    #if PY_MAJOR_VERSION >= 3
-    assert(PyUnicode_Check(o));
-    Py_ssize_t size = 0;
-    const char *c = PyUnicode_AsUTF8AndSize(o, &size);
-    return std::string(c, size);
-    #else
-    assert(PyString_Check(o));
-    return std::string(PyString_AsString(o), PyString_Size(o));
-    #endif
-}
-
-inline PyObject *StdStringToPyObject(const std::string &s)
+/***********************************************************************
+ * sub-interpreter with its own GIL (python 3.12 and later)
+ **********************************************************************/
+class PythonSubInterpreter : public std::enable_shared_from_this<PythonSubInterpreter>
 {
-    #if PY_MAJOR_VERSION >= 3
-    return PyUnicode_DecodeLocaleAndSize(s.c_str(), s.size(), nullptr);
-    #else
-    return PyString_FromStringAndSize(s.c_str(), s.size());
-    #endif
-}
-
-inline std::string getErrorString(void)
+public:
+    //! get the interpreter shared by this group name, created on first use
+    static std::shared_ptr<PythonSubInterpreter> make(const std::string &group);
+
+    //! get the sub-interpreter of the calling thread's current state or null
+    static std::shared_ptr<PythonSubInterpreter> current(void);
+
+    PythonSubInterpreter(void);
+
+    ~PythonSubInterpreter(void);
+
+    //! make this thread's state current, false when already current
+    bool enter(PyThreadState *&prev);
+
+    //! release the interpreter and restore the previous thread state
+    void exit(PyThreadState *prev);
+
+    //! delete the calling thread's state, called when the thread exits
+    void deleteThreadState(void);
+
+private:
+    PyThreadState *getThreadState(const bool reap = true);
+    PyInterpreterState *_interp;
+    std::mutex _mutex;
+    std::map<std::thread::id, PyThreadState *> _threadStates;
+};
+
+/***********************************************************************
+ * call name parsed once per environment: accessor kind and attribute
+ **********************************************************************/
+struct PythonCallName
 {
-    if (not PyErr_Occurred()) return "";
-    PyObject *type = nullptr, *value = nullptr, *traceback = nullptr;
-    PyErr_Fetch(&type, &value, &traceback);
-    assert(value != nullptr);
-    std::string errorMsg = PyObjToStdString(PyObjectRef(PyObject_Str(value), REF_NEW).obj);
-    Py_XDECREF(type);
-    Py_XDECREF(value);
-    Py_XDECREF(traceback);
-    PyErr_Clear();
-    return errorMsg;
-}
+    enum Kind
+    {
+        CALL_SELF, //"" or "()"
+        CALL_ATTR, //"method"
+        GET_FIELD, //"get:field"
+        SET_FIELD, //"set:field"
+        UNKNOWN_OP, //"other:field"
+    };
+
+    Kind kind;
+    PyObjectRef attr; //interned attribute name or null
+};
 
 /***********************************************************************
  * custom Python environment overload
@@ -55,6 +74,8 @@ class PythonProxyEnvironment :
 public:
     PythonProxyEnvironment(const Pothos::ProxyEnvironmentArgs &);
 
+    ~PythonProxyEnvironment(void);
+
     Pothos::Proxy makeHandle(PyObject *obj, const bool borrowed);
     Pothos::Proxy makeHandle(const PyObjectRef &ref);
 
@@ -71,6 +92,48 @@ public:
     Pothos::Object convertProxyToObject(const Pothos::Proxy &proxy);
     void serialize(const Pothos::Proxy &, std::ostream &);
     Pothos::Proxy deserialize(std::istream &);
+
+    //! lookup the parsed call name (call with the GIL held)
+    const PythonCallName &internCallName(const std::string &name);
+
+    //! lookup the class name by type pointer (call with the GIL held)
+    const std::string &getClassName(PyObject *obj);
+
+    //! is this object a Pothos.PothosModule.Proxy (call with the GIL held)
+    bool isPothosProxy(PyObject *obj);
+
+    //! handles cache resolved bound callables when enabled by "cache_calls"
+    const bool cacheCalls;
+
+    //! the interpreter selected by the "interpreter" group or null for main
+    const std::shared_ptr<PythonSubInterpreter> subInterpreter;
+
+    //! the sub-interpreter current at creation without a group, not kept alive
+    const std::weak_ptr<PythonSubInterpreter> parentInterpreter;
+    const bool hasParentInterpreter;
+
+    //! false once python or the bound sub-interpreter has ended
+    bool interpreterAlive(void) const;
+
+private:
+    //the caches are shared by threads without a GIL in free-threaded builds
+    PyStateMutex _cacheMutex;
+    PyObjectRef _proxyType;
+    std::unordered_map<std::string, PythonCallName> _callNames;
+    std::unordered_map<PyTypeObject *, std::pair<PyObjectRef, std::string>> _classNames;
+};
+
+/***********************************************************************
+ * acquire the interpreter of an environment and its GIL
+ **********************************************************************/
+struct PyInterpLock
+{
+    PyInterpLock(const PythonProxyEnvironment *env);
+    ~PyInterpLock(void);
+    std::shared_ptr<PythonSubInterpreter> _interp;
+    PyGILState_STATE _s;
+    PyThreadState *_prev;
+    bool _entered;
 };
 
 /***********************************************************************
@@ -99,4 +162,8 @@ public:
 
     PyObject *obj;
     PyObjectRef ref;
+
+    //resolved bound callables when the environment enables call caching
+    PyStateMutex boundCallsMutex;
+    std::unordered_map<const PythonCallName *, PyObjectRef> boundCalls;
 };
@@ -0,0 +1,66 @@
+// Copyright (c) 2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include "PythonStartup.hpp"
+#include <Pothos/Plugin.hpp>
+#include <json.hpp>
+#include <mutex>
+
+/***********************************************************************
+ * Recorded phases in the order they completed
+ **********************************************************************/
+static std::mutex &getStartupMutex(void)
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+static nlohmann::json &getStartupPhases(void)
+{
+    static nlohmann::json phases = nlohmann::json::array();
+    return phases;
+}
+
+PythonStartupTimer::PythonStartupTimer(const std::string &phase, const std::string &target):
+    _phase(phase),
+    _target(target),
+    _start(std::chrono::steady_clock::now()),
+    _stopped(false)
+{
+    return;
+}
+
+PythonStartupTimer::~PythonStartupTimer(void)
+{
+    this->stop();
+}
+
+void PythonStartupTimer::stop(void)
+{
+    if (_stopped) return;
+    _stopped = true;
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - _start;
+
+    nlohmann::json entry;
+    entry["Phase"] = _phase;
+    if (not _target.empty()) entry["Target"] = _target;
+    entry["Seconds"] = elapsed.count();
+
+    std::lock_guard<std::mutex> lock(getStartupMutex());
+    getStartupPhases().push_back(entry);
+}
+
+static std::string getPythonStartupJSON(void)
+{
+    std::lock_guard<std::mutex> lock(getStartupMutex());
+    nlohmann::json topObj;
+    topObj["Python Startup"] = getStartupPhases();
+    return topObj.dump();
+}
+
+pothos_static_block(registerPythonStartup)
+{
+    Pothos::PluginRegistry::addCall(
+        "/devices/python/startup",
+        Pothos::Callable(&getPythonStartupJSON));
+}
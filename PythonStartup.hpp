@@ -0,0 +1,26 @@
+// Copyright (c) 2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <chrono>
+#include <string>
+
+/*!
+ * Time a phase of python startup for the /devices/python/startup report.
+ * The phase is recorded when stop() is called or the timer is destroyed.
+ */
+class PythonStartupTimer
+{
+public:
+    PythonStartupTimer(const std::string &phase, const std::string &target = "");
+
+    ~PythonStartupTimer(void);
+
+    void stop(void);
+
+private:
+    const std::string _phase;
+    const std::string _target;
+    const std::chrono::steady_clock::time_point _start;
+    bool _stopped;
+};
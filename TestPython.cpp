@@ -4,6 +4,7 @@
 
 #include <Pothos/Testing.hpp>
 #include <Pothos/Proxy.hpp>
+#include <Pothos/Managed.hpp>
 #include <Pothos/Framework/BufferChunk.hpp>
 #include <Poco/File.h>
 #include <Poco/Logger.h>
@@ -13,9 +14,48 @@
 #include <complex>
 #include <cstdlib>
 #include <fstream>
+#include <iterator>
 #include <sstream>
 #include <complex>
 #include <limits>
+#include <thread>
+#include <vector>
+
+/***********************************************************************
+ * managed numeric vectors for the python conversion tests
+ **********************************************************************/
+struct PythonTestVectors
+{
+    template <typename T>
+    static std::vector<T> ramp(const int num)
+    {
+        std::vector<T> vec(num);
+        for (int i = 0; i < num; i++) vec[i] = T(i);
+        return vec;
+    }
+
+    std::vector<int> ints(const int num)
+    {
+        return ramp<int>(num);
+    }
+
+    std::vector<float> floats(const int num)
+    {
+        return ramp<float>(num);
+    }
+
+    std::vector<std::complex<float>> complexFloats(const int num)
+    {
+        return ramp<std::complex<float>>(num);
+    }
+};
+
+static auto managedPythonTestVectors = Pothos::ManagedClass()
+    .registerConstructor<PythonTestVectors>()
+    .registerMethod(POTHOS_FCN_TUPLE(PythonTestVectors, ints))
+    .registerMethod(POTHOS_FCN_TUPLE(PythonTestVectors, floats))
+    .registerMethod(POTHOS_FCN_TUPLE(PythonTestVectors, complexFloats))
+    .commit("Pothos/Python/TestVectors");
 
 POTHOS_TEST_BLOCK("/proxy/python/tests", test_basic_types)
 {
@@ -183,6 +223,133 @@ POTHOS_TEST_BLOCK("/proxy/python/tests", test_call_module)
     POTHOS_TEST_EQUAL(datetime2000.get<int>("year"), 2000);
 }
 
+POTHOS_TEST_BLOCK("/proxy/python/tests", test_call_cache)
+{
+    Pothos::ProxyEnvironmentArgs args;
+    args["cache_calls"] = "true";
+    auto env = Pothos::ProxyEnvironment::make("python", args);
+
+    //repeated calls on the same handle reuse the bound method
+    auto list = env->makeProxy(std::vector<int>());
+    for (int i = 0; i < 10; i++) list.call("append", i%2);
+    POTHOS_TEST_EQUAL(list.call<int>("__len__"), 10);
+    POTHOS_TEST_EQUAL(list.call<int>("count", 1), 5);
+
+    //field accessors use the same interned names
+    auto ns = env->findProxy("argparse").call("Namespace");
+    ns.set("answer", 42);
+    POTHOS_TEST_EQUAL(ns.get<int>("answer"), 42);
+    ns.set("answer", 43);
+    POTHOS_TEST_EQUAL(ns.get<int>("answer"), 43);
+    POTHOS_TEST_THROWS(ns.call("bad:answer"), Pothos::ProxyHandleCallError);
+}
+
+POTHOS_TEST_BLOCK("/proxy/python/tests", test_call_num_args)
+{
+    auto env = Pothos::ProxyEnvironment::make("python");
+
+    //small counts use the stack arguments, large counts the tuple
+    POTHOS_TEST_EQUAL(env->makeProxy("x").call<std::string>("format"), "x");
+    POTHOS_TEST_EQUAL(env->makeProxy("{}").call<std::string>("format", 1), "1");
+    POTHOS_TEST_EQUAL(env->makeProxy("{}{}").call<std::string>("format", 1, 2), "12");
+    POTHOS_TEST_EQUAL(env->makeProxy("{}{}{}").call<std::string>("format", 1, 2, 3), "123");
+    POTHOS_TEST_EQUAL(env->makeProxy("{}{}{}{}{}").call<std::string>("format", 1, 2, 3, 4, 5), "12345");
+    POTHOS_TEST_EQUAL(env->makeProxy("{}{}{}{}{}{}{}{}{}{}").call<std::string>(
+        "format", 0, 1, 2, 3, 4, 5, 6, 7, 8, 9), "0123456789");
+}
+
+POTHOS_TEST_BLOCK("/proxy/python/tests", test_sub_interpreter)
+{
+    Pothos::ProxyEnvironmentArgs args;
+    args["interpreter"] = "test_sub_interpreter";
+    Pothos::ProxyEnvironment::Sptr subEnv;
+    try
+    {
+        subEnv = Pothos::ProxyEnvironment::make("python", args);
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        std::cout << "Skipping test: " << ex.displayText() << std::endl;
+        return;
+    }
+    auto env = Pothos::ProxyEnvironment::make("python");
+
+    //modules are imported separately in each interpreter
+    auto subSys = subEnv->findProxy("sys");
+    subSys.set("pothos_test_value", 42);
+    POTHOS_TEST_EQUAL(subSys.get<int>("pothos_test_value"), 42);
+    auto builtins = env->findProxy("builtins");
+    POTHOS_TEST_TRUE(not builtins.call<bool>("hasattr", env->findProxy("sys"), "pothos_test_value"));
+
+    //environments with the same group name share the interpreter
+    auto sameEnv = Pothos::ProxyEnvironment::make("python", args);
+    POTHOS_TEST_EQUAL(sameEnv->findProxy("sys").get<int>("pothos_test_value"), 42);
+
+    //values cross between interpreters through conversion
+    auto subMath = subEnv->findProxy("math");
+    POTHOS_TEST_EQUAL(subMath.call<double>("sqrt", env->makeProxy(16.0)), 4.0);
+
+    //the PothosModule imports with its own state in the sub-interpreter
+    auto subManaged = subEnv->findProxy("Pothos").call("ProxyEnvironment", "managed");
+    auto dtypeClass = subManaged.call("findProxy", "Pothos/DType");
+    POTHOS_TEST_EQUAL(dtypeClass.getEnvironment()->getName(), "managed");
+    POTHOS_TEST_EQUAL(dtypeClass.call("()", "float32").call<size_t>("size"), 4);
+}
+
+POTHOS_TEST_BLOCK("/proxy/python/tests", test_sub_interpreter_then_main)
+{
+    Pothos::ProxyEnvironmentArgs args;
+    args["interpreter"] = "test_sub_interpreter_then_main";
+    Pothos::ProxyEnvironment::Sptr subEnv;
+    try
+    {
+        subEnv = Pothos::ProxyEnvironment::make("python", args);
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        std::cout << "Skipping test: " << ex.displayText() << std::endl;
+        return;
+    }
+    auto env = Pothos::ProxyEnvironment::make("python");
+    env->findProxy("sys").set("pothos_test_main", true);
+    const std::string check("hasattr(__import__('sys'), 'pothos_test_main')");
+
+    //a fresh thread enters the sub-interpreter first, then the main interpreter
+    bool subResult(true), mainResult(false);
+    std::string error;
+    std::thread thread([&](void)
+    {
+        try
+        {
+            auto subBuiltins = subEnv->findProxy("builtins");
+            subResult = subBuiltins.call<bool>("eval", check, subBuiltins.call("dict"));
+            auto builtins = env->findProxy("builtins");
+            mainResult = builtins.call<bool>("eval", check, builtins.call("dict"));
+        }
+        catch (const Pothos::Exception &ex)
+        {
+            error = ex.displayText();
+        }
+    });
+    thread.join();
+    POTHOS_TEST_EQUAL(error, "");
+    POTHOS_TEST_TRUE(not subResult);
+    POTHOS_TEST_TRUE(mainResult);
+}
+
+POTHOS_TEST_BLOCK("/proxy/python/tests", test_class_names)
+{
+    auto env = Pothos::ProxyEnvironment::make("python");
+
+    //builtin types are not qualified with the module name
+    POTHOS_TEST_EQUAL(env->makeProxy(1).getClassName(), "int");
+    POTHOS_TEST_EQUAL(env->makeProxy(2).getClassName(), "int");
+
+    auto datetimeClass = env->findProxy("datetime").get("datetime");
+    POTHOS_TEST_EQUAL(datetimeClass(2000, 1, 1).getClassName(), "datetime.datetime");
+    POTHOS_TEST_EQUAL(datetimeClass(2001, 1, 1).getClassName(), "datetime.datetime");
+}
+
 POTHOS_TEST_BLOCK("/proxy/python/tests", test_serialization)
 {
     auto env = Pothos::ProxyEnvironment::make("python");
@@ -214,6 +381,110 @@ POTHOS_TEST_BLOCK("/proxy/python/tests", test_serialization)
     POTHOS_TEST_EQUAL(find1->second.convert<int>(), 2);
 }
 
+POTHOS_TEST_BLOCK("/proxy/python/tests", test_serialize_numpy)
+{
+    auto env = Pothos::ProxyEnvironment::make("python");
+    auto numpy = env->findProxy("numpy");
+    auto array = numpy.call("arange", 10000).call("reshape", 100, 100);
+
+    //numpy arrays and library classes are not supported by marshal
+    Pothos::ProxyVector testVec;
+    testVec.push_back(array);
+    testVec.push_back(array.get("T"));
+    testVec.push_back(env->findProxy("fractions").call("Fraction", 1, 3));
+    auto proxyVec = env->makeProxy(testVec);
+
+    std::stringstream ss;
+    Pothos::Object(proxyVec).serialize(ss);
+    Pothos::Object deserializeMe;
+    deserializeMe.deserialize(ss);
+    auto resultVec = deserializeMe.extract<Pothos::Proxy>().convert<Pothos::ProxyVector>();
+
+    POTHOS_TEST_EQUAL(resultVec.size(), 3);
+    POTHOS_TEST_TRUE(numpy.call<bool>("array_equal", resultVec[0], array));
+    POTHOS_TEST_TRUE(numpy.call<bool>("array_equal", resultVec[1], array.get("T")));
+    POTHOS_TEST_EQUAL(resultVec[2].toString(), "1/3");
+}
+
+POTHOS_TEST_BLOCK("/proxy/python/tests", test_serialize_stream)
+{
+    auto env = Pothos::ProxyEnvironment::make("python");
+
+    //framed objects are read back one at a time from a single stream
+    std::stringstream ss;
+    env->serialize(env->makeProxy("hello"), ss);
+    env->serialize(env->makeProxy(42), ss);
+    ss << "trailing data";
+    POTHOS_TEST_EQUAL(env->deserialize(ss).convert<std::string>(), "hello");
+    POTHOS_TEST_EQUAL(env->deserialize(ss).convert<int>(), 42);
+
+    std::string trailing;
+    std::getline(ss, trailing);
+    POTHOS_TEST_EQUAL(trailing, "trailing data");
+}
+
+POTHOS_TEST_BLOCK("/proxy/python/tests", test_serialize_code)
+{
+    auto env = Pothos::ProxyEnvironment::make("python");
+
+    //code objects are rejected by pickle and fall back to marshal
+    auto builtins = env->findProxy("builtins");
+    auto code = builtins.call("compile", "6*7", "<test>", "eval");
+    std::stringstream ss;
+    env->serialize(code, ss);
+    POTHOS_TEST_EQUAL(ss.str().substr(0, 4), "PYM1");
+    POTHOS_TEST_EQUAL(builtins.call<int>("eval", env->deserialize(ss)), 42);
+}
+
+POTHOS_TEST_BLOCK("/proxy/python/tests", test_serialize_truncated)
+{
+    auto env = Pothos::ProxyEnvironment::make("python");
+    auto array = env->findProxy("numpy").call("arange", 10000);
+    std::stringstream ss;
+    env->serialize(array, ss);
+    const auto data = ss.str();
+
+    //a stream cut short is an error, not a partial object
+    std::stringstream truncated(data.substr(0, data.size()-100));
+    POTHOS_TEST_THROWS(env->deserialize(truncated), Pothos::ProxySerializeError);
+
+    //corrupt sizes are rejected instead of allocated
+    std::stringstream badLength(std::string("PYM1")+std::string(8, '\xff'));
+    POTHOS_TEST_THROWS(env->deserialize(badLength), Pothos::ProxySerializeError);
+    std::stringstream badCount(std::string("PYP5")+std::string(8, '\0')+std::string(8, '\x7f'));
+    POTHOS_TEST_THROWS(env->deserialize(badCount), Pothos::ProxySerializeError);
+}
+
+//! a stream buffer over a string that cannot seek, like a socket
+struct UnseekableBuf : std::streambuf
+{
+    UnseekableBuf(const std::string &data):
+        data(data)
+    {
+        this->setg(&this->data[0], &this->data[0], &this->data[0]+this->data.size());
+    }
+    std::string data;
+};
+
+POTHOS_TEST_BLOCK("/proxy/python/tests", test_serialize_unseekable)
+{
+    auto env = Pothos::ProxyEnvironment::make("python");
+    auto numpy = env->findProxy("numpy");
+    auto array = numpy.call("arange", 1 << 19);
+    std::stringstream ss;
+    env->serialize(array, ss);
+
+    //parts are read in growing chunks when the stream size is unknown
+    UnseekableBuf buf(ss.str());
+    std::istream is(&buf);
+    auto result = env->deserialize(is);
+    POTHOS_TEST_TRUE(numpy.call<bool>("array_equal", result, array));
+
+    UnseekableBuf truncated(ss.str().substr(0, 1 << 20));
+    std::istream truncatedIs(&truncated);
+    POTHOS_TEST_THROWS(env->deserialize(truncatedIs), Pothos::ProxySerializeError);
+}
+
 POTHOS_TEST_BLOCK("/proxy/python/tests", test_numpy_array)
 {
     auto env = Pothos::ProxyEnvironment::make("python");
@@ -271,6 +542,7 @@ POTHOS_TEST_BLOCK("/proxy/python/tests", test_logging_python_warnings)
     const std::string warningTypeName = "UserWarning";
     const std::string warningMessage = "This is a warning message.";
     env->findProxy("Pothos.TestPothos").call("CallWarning", warningMessage);
+    env->findProxy("Pothos").call("flushLogs");
     POTHOS_TEST_TRUE(Poco::File(logPath).exists());
 
     // Get the contents of the log file.
@@ -293,3 +565,72 @@ POTHOS_TEST_BLOCK("/proxy/python/tests", test_logging_python_warnings)
         POTHOS_TEST_TRUE(std::string::npos != fileContents.find(expectedString));
     }
 }
+
+POTHOS_TEST_BLOCK("/proxy/python/tests", test_logging_async_logger)
+{
+    auto env = Pothos::ProxyEnvironment::make("python");
+
+    const std::string logPath = Poco::TemporaryFile::tempName();
+    Poco::TemporaryFile::registerForDeletion(logPath);
+    auto &pocoLogger = Poco::Logger::get("TestPythonAsyncLogger");
+    pocoLogger.setChannel(new Poco::SimpleFileChannel(logPath));
+    pocoLogger.setLevel(Poco::Message::PRIO_DEBUG);
+    const auto readLog = [&logPath](void)
+    {
+        std::ifstream ifile(logPath.c_str());
+        return std::string(std::istreambuf_iterator<char>(ifile), std::istreambuf_iterator<char>());
+    };
+
+    //records over the limit of 10 per second are dropped
+    auto logger = env->findProxy("Pothos").call("AsyncLogger", "TestPythonAsyncLogger", 10);
+    for (int i = 0; i < 100; i++) logger.call("log", "TestPython", "record "+std::to_string(i), 20);
+
+    //flush logs the queued records in arrival order
+    logger.call("flush");
+    const auto records = readLog();
+    size_t numLogged(0), pos(0);
+    for (int i = 0; i < 100; i++)
+    {
+        const auto found = records.find("record "+std::to_string(i)+"\n", pos);
+        if (found == std::string::npos) continue;
+        POTHOS_TEST_TRUE(found >= pos);
+        pos = found;
+        numLogged++;
+    }
+    POTHOS_TEST_TRUE(records.find("record 0\n") != std::string::npos);
+    POTHOS_TEST_TRUE(numLogged >= 10 and numLogged <= 20);
+    const auto dropped = logger.get<long long>("dropped");
+    POTHOS_TEST_EQUAL(size_t(dropped)+numLogged, 100);
+
+    //the remaining drops are reported when the logger is released
+    logger = Pothos::Proxy();
+    const auto report = readLog();
+    long long reported(0);
+    for (size_t p = report.find("dropped "); p != std::string::npos; p = report.find("dropped ", p+1))
+    {
+        reported += std::stoll(report.substr(p+8));
+    }
+    POTHOS_TEST_EQUAL(reported, dropped);
+}
+
+POTHOS_TEST_BLOCK("/proxy/python/tests", test_logging_level_sync)
+{
+    auto env = Pothos::ProxyEnvironment::make("python");
+    auto pyLogger = env->findProxy("logging").call("getLogger", "TestPythonLevelSync");
+    auto pocoLogger = &Poco::Logger::get("TestPythonLevelSync");
+
+    //the python level follows the Poco level when bound
+    pocoLogger->setLevel(Poco::Message::PRIO_ERROR);
+    env->findProxy("Pothos").call("bindLogger", pyLogger);
+    POTHOS_TEST_EQUAL(pyLogger.call<int>("getEffectiveLevel"), 40);
+    POTHOS_TEST_TRUE(not pyLogger.call<bool>("isEnabledFor", 30));
+
+    //Poco level changes are applied on sync
+    pocoLogger->setLevel(Poco::Message::PRIO_DEBUG);
+    env->findProxy("Pothos").call("syncLogLevels");
+    POTHOS_TEST_TRUE(pyLogger.call<bool>("isEnabledFor", 10));
+
+    pocoLogger->setLevel(Poco::Message::PRIO_WARNING);
+    env->findProxy("Pothos").call("syncLogLevels");
+    POTHOS_TEST_EQUAL(pyLogger.call<int>("getEffectiveLevel"), 30);
+}
@@ -3,10 +3,15 @@
 
 #include <Pothos/Framework.hpp>
 #include <Pothos/Managed.hpp>
+#include <Pothos/Plugin.hpp>
 #include <Pothos/Testing.hpp>
 #include <Pothos/Proxy.hpp>
+#include <Poco/Logger.h>
+#include <chrono>
 #include <iostream>
 #include <json.hpp>
+#include <set>
+#include <thread>
 
 using json = nlohmann::json;
 
@@ -16,6 +21,27 @@ POTHOS_TEST_BLOCK("/proxy/python/tests", python_module_import)
     env->findProxy("Pothos");
 }
 
+POTHOS_TEST_BLOCK("/proxy/python/tests", test_python_startup_report)
+{
+    auto env = Pothos::ProxyEnvironment::make("python");
+    const auto plugin = Pothos::PluginRegistry::get("/devices/python/startup");
+    const auto report = json::parse(plugin.getObject().extract<Pothos::Callable>().call<std::string>());
+    std::cout << report.dump(4) << std::endl;
+
+    //the interpreter setup phases are recorded with their durations
+    const auto &phases = report.at("Python Startup");
+    POTHOS_TEST_TRUE(phases.is_array());
+    std::set<std::string> names;
+    for (const auto &phase : phases)
+    {
+        POTHOS_TEST_TRUE(phase.at("Seconds").get<double>() >= 0.0);
+        names.insert(phase.at("Phase").get<std::string>());
+    }
+    POTHOS_TEST_EQUAL(names.count("Py_Initialize"), 1);
+    POTHOS_TEST_EQUAL(names.count("sys setup"), 1);
+    POTHOS_TEST_EQUAL(names.count("import Pothos"), 1);
+}
+
 POTHOS_TEST_BLOCK("/proxy/python/tests", test_python_module)
 {
     auto env = Pothos::ProxyEnvironment::make("python");
@@ -49,6 +75,90 @@ POTHOS_TEST_BLOCK("/proxy/python/tests", test_python_block)
     std::cout << "run done\n";
 }
 
+//forwarder using the batched label and message calls of the port wrappers
+static const char *batchForwarderSource =
+    "import Pothos\n"
+    "class BatchForwarder(Pothos.Block):\n"
+    "    def __init__(self, dtype):\n"
+    "        Pothos.Block.__init__(self)\n"
+    "        self.setupInput('0', dtype)\n"
+    "        self.setupOutput('0', dtype)\n"
+    "    def work(self):\n"
+    "        in0 = self.input('0')\n"
+    "        out0 = self.output('0')\n"
+    "        out0.postMessages(in0.popMessages(16))\n"
+    "        inBuff = in0.buffer()\n"
+    "        outBuff = out0.buffer()\n"
+    "        n = min(len(inBuff), len(outBuff))\n"
+    "        if n == 0: return\n"
+    "        labels = [l for l in in0.labels() if l.index < n]\n"
+    "        out0.postLabels(labels)\n"
+    "        in0.removeLabels(labels)\n"
+    "        outBuff[:n] = inBuff[:n]\n"
+    "        in0.consume(n)\n"
+    "        out0.produce(n)\n";
+
+POTHOS_TEST_BLOCK("/proxy/python/tests", test_python_block_batch_calls)
+{
+    auto env = Pothos::ProxyEnvironment::make("python");
+    auto builtins = env->findProxy("builtins");
+    auto ns = builtins.call("dict");
+    builtins.call("eval", builtins.call("compile", std::string(batchForwarderSource), std::string("<test>"), std::string("exec")), ns);
+    auto forwarder = ns.call("__getitem__", std::string("BatchForwarder"))(Pothos::DType("int"));
+
+    auto feeder = Pothos::BlockRegistry::make("/blocks/feeder_source", "int");
+    auto collector = Pothos::BlockRegistry::make("/blocks/collector_sink", "int");
+    json testPlan;
+    testPlan["enableBuffers"] = true;
+    testPlan["enableLabels"] = true;
+    testPlan["enableMessages"] = true;
+    auto expected = feeder.call("feedTestPlan", testPlan.dump());
+
+    //messages and labels pass through the batched calls in order
+    {
+        Pothos::Topology topology;
+        topology.connect(feeder, 0, forwarder, 0);
+        topology.connect(forwarder, 0, collector, 0);
+        topology.commit();
+        POTHOS_TEST_TRUE(topology.waitInactive(0.5, 5.0));
+    }
+
+    collector.call("verifyTestPlan", expected);
+}
+
+POTHOS_TEST_BLOCK("/proxy/python/tests", test_python_block_log_level)
+{
+    auto env = Pothos::ProxyEnvironment::make("python");
+    auto module = env->findProxy("Pothos");
+    auto pyLogger = env->findProxy("logging").call("getLogger", "Pothos");
+    auto &pocoLogger = Poco::Logger::get("Pothos");
+    const auto oldLevel = pocoLogger.getLevel();
+
+    //wait for the drainer tick to count the Poco level change
+    const auto generation = module.call<long long>("getLogLevelGeneration", false);
+    pocoLogger.setLevel(Poco::Message::PRIO_ERROR);
+    for (int i = 0; i < 50 and module.call<long long>("getLogLevelGeneration", false) == generation; i++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    //a python block that never logs applies the level when activated
+    auto feeder = Pothos::BlockRegistry::make("/blocks/feeder_source", "int");
+    auto collector = Pothos::BlockRegistry::make("/blocks/collector_sink", "int");
+    auto forwarder = Pothos::BlockRegistry::make("/python/forwarder", Pothos::DType("int"));
+    {
+        Pothos::Topology topology;
+        topology.connect(feeder, 0, forwarder, 0);
+        topology.connect(forwarder, 0, collector, 0);
+        topology.commit();
+        POTHOS_TEST_TRUE(topology.waitInactive(0.5, 5.0));
+    }
+    POTHOS_TEST_EQUAL(pyLogger.call<int>("getEffectiveLevel"), 40);
+
+    pocoLogger.setLevel(oldLevel);
+    module.call("syncLogLevels");
+}
+
 POTHOS_TEST_BLOCK("/proxy/python/tests", test_signals_and_slots)
 {
     auto env = Pothos::ProxyEnvironment::make("managed");
@@ -0,0 +1,134 @@
+// Copyright (c) 2026 Josh Blum
+// SPDX-License-Identifier: BSL-1.0
+
+#include <Pothos/System/Version.hpp>
+#if POTHOS_API_VERSION >= 0x00050000
+#include "PythonConfLoader.hpp"
+#include <Pothos/Testing.hpp>
+#include <Pothos/Proxy.hpp>
+#include <Poco/File.h>
+#include <Poco/TemporaryFile.h>
+#include <fstream>
+
+using json = nlohmann::json;
+
+static void writeFile(const std::string &path, const std::string &contents)
+{
+    std::ofstream ofs(path.c_str());
+    ofs << contents;
+}
+
+static json makeDocCache(const std::string &source)
+{
+    json files = json::object();
+    files[source] = {{"stat", getFileStat(source)}, {"docs", {{"/blocks/test", "{}"}}}};
+    return {{"version", getDocCacheVersion()}, {"files", files}};
+}
+
+POTHOS_TEST_BLOCK("/proxy/python/tests", test_doc_cache_hit)
+{
+    Poco::TemporaryFile source, cacheFile;
+    writeFile(source.path(), "print('hello')\n");
+
+    //a saved cache loads back and its entry is valid while the source is unchanged
+    const auto cache = makeDocCache(source.path());
+    saveDocCache(cacheFile.path(), cache);
+    const auto loaded = loadDocCache(cacheFile.path());
+    POTHOS_TEST_TRUE(loaded == cache);
+    POTHOS_TEST_TRUE(isDocCacheHit(loaded["files"], source.path(), getFileStat(source.path())));
+    POTHOS_TEST_TRUE(not isDocCacheHit(loaded["files"], source.path()+".other", getFileStat(source.path())));
+}
+
+POTHOS_TEST_BLOCK("/proxy/python/tests", test_doc_cache_invalidation)
+{
+    Poco::TemporaryFile source;
+    writeFile(source.path(), "print('hello')\n");
+    const auto files = makeDocCache(source.path())["files"];
+
+    //a size change invalidates the entry
+    writeFile(source.path(), "print('hello world')\n");
+    POTHOS_TEST_TRUE(not isDocCacheHit(files, source.path(), getFileStat(source.path())));
+
+    //an mtime change with the same size invalidates the entry
+    writeFile(source.path(), "print('hello')\n");
+    const auto mtime = getFileStat(source.path())[0].get<Poco::Timestamp::TimeVal>();
+    Poco::File(source.path()).setLastModified(Poco::Timestamp(mtime - 2000000));
+    POTHOS_TEST_TRUE(not isDocCacheHit(files, source.path(), getFileStat(source.path())));
+
+    //a removed source is never a hit
+    Poco::File(source.path()).remove();
+    POTHOS_TEST_TRUE(getFileStat(source.path()).is_null());
+    POTHOS_TEST_TRUE(not isDocCacheHit(files, source.path(), getFileStat(source.path())));
+}
+
+POTHOS_TEST_BLOCK("/proxy/python/tests", test_doc_cache_corrupt)
+{
+    Poco::TemporaryFile cacheFile;
+
+    //missing, corrupt, and other version caches load as empty
+    POTHOS_TEST_TRUE(loadDocCache(cacheFile.path()).empty());
+    writeFile(cacheFile.path(), "{\"version\": \"");
+    POTHOS_TEST_TRUE(loadDocCache(cacheFile.path()).empty());
+    writeFile(cacheFile.path(), "[1, 2, 3]");
+    POTHOS_TEST_TRUE(loadDocCache(cacheFile.path()).empty());
+    writeFile(cacheFile.path(), json({{"version", "other"}, {"files", json::object()}}).dump());
+    POTHOS_TEST_TRUE(loadDocCache(cacheFile.path()).empty());
+
+    //entries without docs are not hits
+    const json files = {{"source.py", {{"stat", {1, 2}}}}};
+    POTHOS_TEST_TRUE(not isDocCacheHit(files, "source.py", json::array({1, 2})));
+}
+
+POTHOS_TEST_BLOCK("/proxy/python/tests", test_doc_parse_parallel)
+{
+    std::vector<std::string> sources;
+    for (size_t i = 0; i < 16; i++)
+    {
+        sources.push_back(Poco::TemporaryFile::tempName()+".py");
+        Poco::TemporaryFile::registerForDeletion(sources.back());
+        const auto num = std::to_string(i);
+        writeFile(sources.back(), "\"\"\"/*\n|PothosDoc Test Block "+num+"\n|category /Test\n|factory /test/block"+num+"()\n*/\"\"\"\n");
+    }
+
+    //parallel parsing gives the same docs as serial parsing
+    const auto serial = parseDocsParallel(sources, 1);
+    const auto parallel = parseDocsParallel(sources, 4);
+    POTHOS_TEST_EQUAL(serial.size(), sources.size());
+    POTHOS_TEST_TRUE(serial == parallel);
+    POTHOS_TEST_TRUE(serial.front().count("/test/block0") == 1);
+}
+
+POTHOS_TEST_BLOCK("/proxy/python/tests", test_python_factory_resolve)
+{
+    //install a module with a factory function into sys.modules
+    auto env = Pothos::ProxyEnvironment::make("python");
+    auto sysModules = env->findProxy("sys").call("get:modules");
+    auto module = env->findProxy("types").call("ModuleType", "pothos_test_factory");
+    module.call("set:make", env->findProxy("builtins").call("get:list"));
+    sysModules.call("__setitem__", "pothos_test_factory", module);
+
+    //the factory is resolved once and then reused
+    PythonFactory factory({}, "pothos_test_factory", "make", {});
+    const auto callable = factory.resolve();
+    POTHOS_TEST_TRUE(callable.getHandle() == factory.resolve().getHandle());
+
+    //a reloaded factory is resolved again
+    module.call("set:make", env->findProxy("builtins").call("get:tuple"));
+    POTHOS_TEST_TRUE(callable.getHandle() != factory.resolve().getHandle());
+    POTHOS_TEST_EQUAL(factory.resolve().compareTo(module.call("get:make")), 0);
+
+    //a removed module is looked up again and no longer found
+    sysModules.call("pop", "pothos_test_factory");
+    POTHOS_TEST_THROWS(factory.resolve(), Pothos::Exception);
+}
+
+POTHOS_TEST_BLOCK("/proxy/python/tests", test_python_factory_not_found)
+{
+    PythonFactory missingModule({}, "pothos_test_no_such_module", "make", {});
+    POTHOS_TEST_THROWS(missingModule.resolve(), Pothos::Exception);
+
+    PythonFactory missingFunction({}, "os", "pothos_test_no_such_function", {});
+    POTHOS_TEST_THROWS(missingFunction.resolve(), Pothos::Exception);
+}
+
+#endif //POTHOS_API_VERSION >= 0x00050000
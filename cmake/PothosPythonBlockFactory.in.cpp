@@ -3,11 +3,51 @@
 
 #include <Pothos/Framework.hpp>
 #include <Pothos/Proxy.hpp>
+#include <Pothos/Plugin.hpp>
+#include <Pothos/Callable.hpp>
+#include <mutex>
+
+static Pothos::Proxy get@class_name@Callable(void)
+{
+    //the environment and class are resolved on first use,
+    //and again when the module was reloaded or the interpreter ended
+    static std::mutex mutex;
+    static Pothos::Proxy callable;
+    static Pothos::Callable isCurrent;
+    std::lock_guard<std::mutex> lock(mutex);
+    if (callable)
+    {
+        try
+        {
+            if (isCurrent.call<bool>(callable, std::string("@package_name@"), std::string("@class_name@"))) return callable;
+        }
+        catch (const Pothos::Exception &){}
+    }
+    callable = Pothos::Proxy();
+
+    //create python environment, in the interpreter group when specified
+    Pothos::ProxyEnvironmentArgs envArgs;
+    const std::string interpreter("@POTHOS_PYTHON_UTIL_INTERPRETER@");
+    if (not interpreter.empty()) envArgs["interpreter"] = interpreter;
+    auto env = Pothos::ProxyEnvironment::make("python", envArgs);
+
+    //locate the module and the class within it
+    try
+    {
+        callable = env->findProxy("@package_name@").call("get:@class_name@");
+    }
+    catch (const Pothos::Exception &ex)
+    {
+        throw Pothos::Exception("@class_name@Factory()", "factory @package_name@.@class_name@ not found: "+ex.displayText());
+    }
+    isCurrent = Pothos::PluginRegistry::get("/proxy_helpers/python/is_module_attribute_current").getObject().extract<Pothos::Callable>();
+    return callable;
+}
 
 static Pothos::Object @class_name@Factory(const Pothos::Object *args, const size_t numArgs)
 {
-    //create python environment
-    auto env = Pothos::ProxyEnvironment::make("python");
+    auto callable = get@class_name@Callable();
+    auto env = callable.getEnvironment();
 
     //convert arguments into proxy environment
     std::vector<Pothos::Proxy> proxyArgs(numArgs);
@@ -16,11 +56,8 @@ static Pothos::Object @class_name@Factory(const Pothos::Object *args, const size
         proxyArgs[i] = env->makeProxy(args[i]);
     }
 
-    //locate the module
-    auto mod = env->findProxy("@package_name@");
-
     //call into the factory
-    auto block = mod.getHandle()->call("@class_name@", proxyArgs.data(), proxyArgs.size());
+    auto block = callable.getHandle()->call("()", proxyArgs.data(), proxyArgs.size());
     return Pothos::Object(block);
 }
 
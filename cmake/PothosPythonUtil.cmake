@@ -51,6 +51,10 @@ endif(NOT POTHOS_PYTHON_DIR)
 ##
 ## DOC_SOURCES - an alternative list of sources to scan for docs
 ##
+## INTERPRETER - optional sub-interpreter group name for the blocks
+## Blocks of the same group share a python interpreter with its own GIL
+## (python 3.12 and later), otherwise the main interpreter is used.
+##
 ## ENABLE_DOCS - enable scanning of SOURCES for documentation markup.
 ##
 ## Most arguments are passed directly to the POTHOS_MODULE_UTIL()
@@ -59,7 +63,7 @@ endif(NOT POTHOS_PYTHON_DIR)
 function(POTHOS_PYTHON_UTIL)
 
     include(CMakeParseArguments)
-    CMAKE_PARSE_ARGUMENTS(POTHOS_PYTHON_UTIL "ENABLE_DOCS" "TARGET;DESTINATION" "SOURCES;DOC_SOURCES;FACTORIES" ${ARGN})
+    CMAKE_PARSE_ARGUMENTS(POTHOS_PYTHON_UTIL "ENABLE_DOCS" "TARGET;DESTINATION;INTERPRETER" "SOURCES;DOC_SOURCES;FACTORIES" ${ARGN})
 
     #generate block registries
     unset(factory_sources)